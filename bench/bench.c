@@ -0,0 +1,200 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file bench.c
+ * @brief Arnés de micro-benchmarks y programa principal de make bench
+ * @details Uso: bench.elf [directorio de resultados]. Escribe resultados.csv y resultados.json.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_CICLOS() __rdtsc()
+#else
+#define BENCH_CICLOS() 0ull
+#endif
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+/**
+ * @struct benchResultado_t
+ * @brief Resultado de un caso
+ */
+typedef struct {
+    const char * suite;
+    const char * caso;
+    uint32_t entradas;
+    uint64_t llamadas;
+    double nsPorLlamada;
+    double ciclosPorLlamada;
+} benchResultado_t;
+
+/* === Private variable declarations =========================================================== */
+static benchResultado_t resultados[BENCH_MAX_RESULTADOS];
+static uint16_t cantidadResultados;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void escribirCsv(const char * ruta) {
+    FILE * archivo = fopen(ruta, "w");
+
+    if (archivo == NULL) {
+        perror(ruta);
+        return;
+    }
+    fprintf(archivo, "suite,caso,entradas,llamadas,ns_por_llamada,llamadas_por_segundo,"
+                     "ns_por_entrada,ciclos_por_llamada\n");
+    for (uint16_t i = 0; i < cantidadResultados; i++) {
+        const benchResultado_t * r = &resultados[i];
+
+        fprintf(archivo, "%s,%s,%u,%llu,%.3f,%.0f,%.4f,%.2f\n", r->suite, r->caso, r->entradas,
+                (unsigned long long)r->llamadas, r->nsPorLlamada, 1e9 / r->nsPorLlamada,
+                r->nsPorLlamada / r->entradas, r->ciclosPorLlamada);
+    }
+    fclose(archivo);
+}
+
+static void escribirJson(const char * ruta) {
+    FILE * archivo = fopen(ruta, "w");
+
+    if (archivo == NULL) {
+        perror(ruta);
+        return;
+    }
+    fprintf(archivo, "{\n  \"compilador\": \"%s\",\n  \"fecha\": %lld,\n  \"resultados\": [\n",
+            __VERSION__, (long long)time(NULL));
+    for (uint16_t i = 0; i < cantidadResultados; i++) {
+        const benchResultado_t * r = &resultados[i];
+
+        fprintf(archivo,
+                "    {\"suite\": \"%s\", \"caso\": \"%s\", \"entradas\": %u, \"llamadas\": %llu, "
+                "\"ns_por_llamada\": %.3f, \"llamadas_por_segundo\": %.0f, "
+                "\"ns_por_entrada\": %.4f, \"ciclos_por_llamada\": %.2f}%s\n",
+                r->suite, r->caso, r->entradas, (unsigned long long)r->llamadas, r->nsPorLlamada,
+                1e9 / r->nsPorLlamada, r->nsPorLlamada / r->entradas, r->ciclosPorLlamada,
+                (i + 1 < cantidadResultados) ? "," : "");
+    }
+    fprintf(archivo, "  ]\n}\n");
+    fclose(archivo);
+}
+
+/* === Public function implementation ========================================================== */
+
+uint64_t bench_Nanosegundos(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+void bench_Medir(const char * suite, const char * caso, uint32_t entradas, benchFn_t fn,
+                 void * contexto) {
+    uint32_t iteraciones = 1000;
+    uint64_t mejorNs = UINT64_MAX;
+    uint64_t mejorCiclos = 0;
+
+    if (cantidadResultados >= BENCH_MAX_RESULTADOS) {
+        return;
+    }
+
+    /* Calibración: duplica las iteraciones hasta superar el tiempo mínimo */
+    for (;;) {
+        uint64_t inicio = bench_Nanosegundos();
+        fn(contexto, iteraciones);
+        if (bench_Nanosegundos() - inicio >= BENCH_TIEMPO_MINIMO_NS || iteraciones >= (1u << 30)) {
+            break;
+        }
+        iteraciones *= 2;
+    }
+
+    for (int i = 0; i < BENCH_REPETICIONES; i++) {
+        uint64_t inicio = bench_Nanosegundos();
+        uint64_t ciclos = BENCH_CICLOS();
+        fn(contexto, iteraciones);
+        ciclos = BENCH_CICLOS() - ciclos;
+        uint64_t ns = bench_Nanosegundos() - inicio;
+
+        if (ns < mejorNs) {
+            mejorNs = ns;
+            mejorCiclos = ciclos;
+        }
+    }
+
+    double nsPorLlamada = (double)mejorNs / iteraciones;
+
+    bench_Registrar(suite, caso, entradas, iteraciones, nsPorLlamada,
+                    (double)mejorCiclos / iteraciones);
+    printf("%-10s %-28s %6u %12.2f ns/llamada %14.0f llamadas/s %10.3f ns/entrada\n", suite, caso,
+           entradas, nsPorLlamada, 1e9 / nsPorLlamada, nsPorLlamada / entradas);
+}
+
+void bench_Registrar(const char * suite, const char * caso, uint32_t entradas, uint64_t llamadas,
+                     double nsPorLlamada, double ciclosPorLlamada) {
+    if (cantidadResultados >= BENCH_MAX_RESULTADOS) {
+        return;
+    }
+
+    benchResultado_t * r = &resultados[cantidadResultados++];
+    r->suite = suite;
+    r->caso = caso;
+    r->entradas = entradas;
+    r->llamadas = llamadas;
+    r->nsPorLlamada = nsPorLlamada;
+    r->ciclosPorLlamada = ciclosPorLlamada;
+}
+
+int main(int argc, char * argv[]) {
+    const char * directorio = (argc > 1) ? argv[1] : ".";
+    char ruta[512];
+
+    benchDelay();
+    benchIO();
+    benchDebounce();
+    benchAlgoritmos();
+    benchVcounter();
+    benchBank();
+    benchMatrix();
+    benchGesture();
+    benchService();
+    benchScheduler();
+
+    snprintf(ruta, sizeof(ruta), "%s/resultados.csv", directorio);
+    escribirCsv(ruta);
+    snprintf(ruta, sizeof(ruta), "%s/resultados.json", directorio);
+    escribirJson(ruta);
+    return 0;
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,118 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+/**
+ * @file bench.h
+ * @brief Arnés de micro-benchmarks para el host
+ * @details Cada caso se calibra para correr al menos BENCH_TIEMPO_MINIMO_NS, se repite
+ * BENCH_REPETICIONES veces y se informa la mejor corrida. Los resultados se imprimen y se
+ * guardan en CSV y JSON para comparar entre versiones.
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions ================================================================ */
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+/** @brief Duración mínima de una corrida calibrada */
+#define BENCH_TIEMPO_MINIMO_NS 20000000ull
+
+/** @brief Corridas por caso, se informa la más rápida */
+#define BENCH_REPETICIONES 5
+
+/** @brief Cantidad máxima de resultados por ejecución */
+#define BENCH_MAX_RESULTADOS 256
+
+/* === Public data type declarations =========================================================== */
+/**
+ * @typedef benchFn_t
+ * @brief Caso a medir: ejecuta iteraciones llamadas a la operación
+ */
+typedef void (*benchFn_t)(void * contexto, uint32_t iteraciones);
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+/**
+ * @brief Mide un caso y guarda el resultado
+ * @param suite Nombre del grupo de casos
+ * @param caso Nombre del caso dentro de la suite
+ * @param entradas Entradas procesadas por llamada, para calcular el costo por entrada
+ * @param fn Caso a medir
+ * @param contexto Puntero que se pasa a fn sin modificar
+ */
+void bench_Medir(const char * suite, const char * caso, uint32_t entradas, benchFn_t fn,
+                 void * contexto);
+
+/**
+ * @brief Guarda un resultado medido fuera de bench_Medir(), sin imprimirlo
+ * @param suite Nombre del grupo de casos
+ * @param caso Nombre del caso dentro de la suite
+ * @param entradas Entradas procesadas por llamada
+ * @param llamadas Llamadas medidas
+ * @param nsPorLlamada Tiempo por llamada en nanosegundos
+ * @param ciclosPorLlamada Ciclos por llamada, 0 si no se midieron
+ */
+void bench_Registrar(const char * suite, const char * caso, uint32_t entradas, uint64_t llamadas,
+                     double nsPorLlamada, double ciclosPorLlamada);
+
+/**
+ * @brief Reloj monotónico en nanosegundos
+ */
+uint64_t bench_Nanosegundos(void);
+
+/** @brief Casos de los algoritmos de antirrebote con las mismas entradas */
+void benchAlgoritmos(void);
+/** @brief Casos de API_debounceBank con 1000, 10000 y 100000 entradas */
+void benchBank(void);
+/** @brief Casos de API_debounce */
+void benchDebounce(void);
+/** @brief Casos de API_delay */
+void benchDelay(void);
+/** @brief Casos de API_gesture */
+void benchGesture(void);
+/** @brief Casos de API_IO */
+void benchIO(void);
+/** @brief Barrido del teclado de 4x4 de API_matrix */
+void benchMatrix(void);
+/** @brief Muestras por segundo y latencia p99 de API_debounceService de 1 a N hilos */
+void benchService(void);
+/** @brief Pasadas de API_scheduler con tiempo virtual */
+void benchScheduler(void);
+/** @brief Casos de API_vcounter comparados con la FSM */
+void benchVcounter(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_H */
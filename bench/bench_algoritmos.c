@@ -0,0 +1,142 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file bench_algoritmos.c
+ * @brief Comparación de los algoritmos de antirrebote con las mismas entradas
+ * @details Para cada algoritmo se mide el costo de una actualización con una entrada con rebotes,
+ * y se informa la memoria de estado y la latencia desde un flanco limpio hasta el evento con una
+ * actualización por milisegundo.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include <stdio.h>
+
+#include "bench.h"
+#include "API_debounce.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Cantidad de muestras distintas precalculadas */
+#define MUESTRAS 1024
+/** @brief Máximo de actualizaciones esperadas para confirmar un flanco limpio */
+#define LATENCIA_MAXIMA 10000u
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+/** @brief Snapshots con rebotes simulados en la entrada del botón */
+static IO_Snapshot_t muestras[MUESTRAS];
+/** @brief Evita que el compilador descarte los resultados */
+static volatile uint32_t sumidero;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** @brief Algoritmos comparados y sus nombres de caso */
+static const struct {
+    debounceAlgorithm_t algoritmo;
+    const char * nombre;
+} casos[] = {
+    {DEBOUNCE_ALG_TIMER, "timer"},
+    {DEBOUNCE_ALG_INTEGRATOR, "integrador"},
+    {DEBOUNCE_ALG_SHIFT, "registro"},
+    {DEBOUNCE_ALG_ADAPTIVE, "adaptativo"},
+    {DEBOUNCE_ALG_EAGER, "anticipado"},
+};
+
+/* === Private function implementation ========================================================= */
+
+static void generarMuestras(void) {
+    uint32_t semilla = 0x9E3779B9u;
+    bool estable = false;
+
+    for (int i = 0; i < MUESTRAS; i++) {
+        semilla ^= semilla << 13;
+        semilla ^= semilla >> 17;
+        semilla ^= semilla << 5;
+        /* Cambia el nivel cada 128 muestras y rebota durante las primeras 8 */
+        if ((i % 128) == 0) {
+            estable = !estable;
+        }
+        bool nivel = ((i % 128) < 8 && (semilla & 1u)) ? !estable : estable;
+        muestras[i] = (IO_Snapshot_t)nivel << IO_BUTTON_USER;
+    }
+}
+
+static void vaciarEventos(void) {
+    event_t evento;
+
+    while (debounce_ReadEvent(&evento)) {
+        sumidero += evento.edge;
+    }
+}
+
+static void actualizar(void * contexto, uint32_t iteraciones) {
+    debounce_t * debounce = contexto;
+
+    for (uint32_t n = 0; n < iteraciones; n++) {
+        debounce_UpdateSnapshotAt(debounce, muestras[n % MUESTRAS], (tick_t)n);
+        sumidero += debounce_ReadPressed(debounce);
+        if ((n & 63u) == 0) {
+            vaciarEventos();
+        }
+    }
+}
+
+/* Actualizaciones, a una por milisegundo, desde un flanco limpio hasta confirmar la presión */
+static uint32_t latencia(debounceAlgorithm_t algoritmo) {
+    debounce_t debounce;
+    const IO_Snapshot_t presionado = (IO_Snapshot_t)1u << IO_BUTTON_USER;
+    uint32_t n;
+
+    debounce_InitWith(&debounce, IO_BUTTON_USER, algoritmo);
+    for (n = 1; n <= LATENCIA_MAXIMA; n++) {
+        debounce_UpdateSnapshotAt(&debounce, presionado, (tick_t)n);
+        if (debounce_ReadPressed(&debounce)) {
+            break;
+        }
+    }
+    vaciarEventos();
+    return n;
+}
+
+/* === Public function implementation ========================================================== */
+
+void benchAlgoritmos(void) {
+    debounce_t debounce;
+
+    generarMuestras();
+    for (unsigned i = 0; i < sizeof(casos) / sizeof(casos[0]); i++) {
+        debounce_InitWith(&debounce, IO_BUTTON_USER, casos[i].algoritmo);
+        bench_Medir("algoritmo", casos[i].nombre, 1, actualizar, &debounce);
+        vaciarEventos();
+    }
+    for (unsigned i = 0; i < sizeof(casos) / sizeof(casos[0]); i++) {
+        printf("%-10s %-28s %3u bytes de estado, %u bytes por instancia, latencia %u ms\n",
+               "algoritmo", casos[i].nombre, debounce_AlgorithmStateSize(casos[i].algoritmo),
+               (unsigned)sizeof(debounce_t), latencia(casos[i].algoritmo));
+    }
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,132 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file bench_bank.c
+ * @brief Memoria por entrada y costo de actualización del antirrebote de muchas entradas
+ * @details Se mide un banco de 1000, 10000 y 100000 entradas con muestras en las que cada tanto
+ * cambia un pequeño porcentaje de entradas con rebotes, y se compara la memoria con una debounce_t
+ * por entrada.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include <stdio.h>
+
+#include "bench.h"
+#include "API_debounceBank.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Mayor cantidad de entradas medida */
+#define ENTRADAS_MAX 100000u
+/** @brief Cantidad de muestras distintas precalculadas */
+#define MUESTRAS 64
+/** @brief Ticks entre actualizaciones, cuatro por retardo de antirrebote */
+#define PERIODO (DELAY_MS(TIEMPO_RETARDO) / 4)
+
+/* === Private data type declarations ========================================================== */
+/**
+ * @struct caso_t
+ * @brief Banco medido y su tiempo virtual
+ */
+typedef struct {
+    debounceBank_t bank;
+    tick_t now;
+} caso_t;
+
+/* === Private variable declarations =========================================================== */
+/** @brief Memoria del banco más grande, los más chicos usan una parte */
+DEBOUNCE_BANK_DEFINE(banco, ENTRADAS_MAX);
+/** @brief Muestras con rebotes simulados, una entrada por bit */
+static debounceBank_word_t muestras[MUESTRAS][DEBOUNCE_BANK_WORDS(ENTRADAS_MAX)];
+/** @brief Evita que el compilador descarte los resultados */
+static volatile uint32_t sumidero;
+
+/** @brief Tamaños de banco medidos */
+static const uint32_t tamanios[] = {1000u, 10000u, 100000u};
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void generarMuestras(void) {
+    uint32_t semilla = 0x2545F491u;
+    static debounceBank_word_t estable[DEBOUNCE_BANK_WORDS(ENTRADAS_MAX)];
+
+    for (int i = 0; i < MUESTRAS; i++) {
+        for (uint32_t p = 0; p < DEBOUNCE_BANK_WORDS(ENTRADAS_MAX); p++) {
+            semilla ^= semilla << 13;
+            semilla ^= semilla >> 17;
+            semilla ^= semilla << 5;
+            /* Cada 16 muestras cambia en promedio una entrada de cada 32 */
+            if ((i % 16) == 0) {
+                estable[p] ^= (debounceBank_word_t)1u << (semilla % DEBOUNCE_BANK_WIDTH);
+            }
+            /* Rebote en algunas entradas durante las dos muestras siguientes */
+            muestras[i][p] = estable[p];
+            if ((i % 16) < 2 && (semilla & 0x300u) == 0) {
+                muestras[i][p] ^= (debounceBank_word_t)1u << ((semilla >> 11) % 32u);
+            }
+        }
+    }
+}
+
+static void actualizar(void * contexto, uint32_t iteraciones) {
+    caso_t * caso = contexto;
+    debounceBank_word_t pressed, released;
+
+    for (uint32_t n = 0; n < iteraciones; n++) {
+        caso->now += PERIODO;
+        sumidero += debounceBank_Update(&caso->bank, muestras[n % MUESTRAS], caso->now);
+        for (uint32_t p = 0; p < caso->bank.palabras; p++) {
+            debounceBank_TakeEdges(&caso->bank, p, &pressed, &released);
+            sumidero ^= pressed;
+        }
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void benchBank(void) {
+    static caso_t caso;
+    char nombre[32];
+
+    generarMuestras();
+    for (unsigned i = 0; i < sizeof(tamanios) / sizeof(tamanios[0]); i++) {
+        debounceBank_Init(&caso.bank, tamanios[i], banco_bits, banco_vencimientos,
+                          DELAY_MS(TIEMPO_RETARDO));
+        caso.now = 0;
+        snprintf(nombre, sizeof(nombre), "%u entradas", (unsigned)tamanios[i]);
+        bench_Medir("bank", nombre, tamanios[i], actualizar, &caso);
+    }
+    for (unsigned i = 0; i < sizeof(tamanios) / sizeof(tamanios[0]); i++) {
+        uint32_t bytes = debounceBank_Footprint(tamanios[i]);
+
+        printf("%-10s %-28u %8u bytes, %.2f bytes por entrada (debounce_t: %u)\n", "bank",
+               (unsigned)tamanios[i], (unsigned)bytes, (double)bytes / tamanios[i],
+               (unsigned)sizeof(debounce_t));
+    }
+}
+
+/* === End of documentation ==================================================================== */
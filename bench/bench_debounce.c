@@ -0,0 +1,296 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file bench_debounce.c
+ * @brief Benchmarks de la FSM de antirrebote por estado y según la cantidad de entradas
+ * @details Las entradas se controlan escribiendo el IDR de la HAL emulada y el tiempo se pasa
+ * explícito con las variantes *At, de modo que cada caso se mantiene en el estado que mide.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "bench.h"
+#include "main.h"
+#include "API_debounce.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Mayor cantidad de entradas medida en el escalado */
+#define MAX_ENTRADAS 4096
+/** @brief Eventos confirmados mientras otro hilo espera en debounce_WaitEvent() */
+#define DESPERTARES 2000u
+
+/* === Private data type declarations ========================================================== */
+/**
+ * @struct escalado_t
+ * @brief Contexto de los casos de escalado
+ */
+typedef struct {
+    debounce_t * instancias;
+    uint32_t cantidad;
+} escalado_t;
+
+/* === Private variable declarations =========================================================== */
+static volatile uint32_t sumidero;
+static debounce_t instancias[MAX_ENTRADAS];
+/** @brief Instante en que se llamó a la actualización que confirma el evento */
+static _Atomic uint64_t marcaEvento;
+/** @brief Tiempo entre la actualización y el regreso de debounce_WaitEvent() */
+static uint64_t latenciasDespertar[DESPERTARES];
+/** @brief Despertares que ya registró el hilo que espera */
+static atomic_uint despertares;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void boton(bool presionado) {
+    if (presionado) {
+        BUTTON_PORT->IDR |= BUTTON_PIN;
+    } else {
+        BUTTON_PORT->IDR &= ~(uint32_t)BUTTON_PIN;
+    }
+}
+
+static void vaciarEventos(void) {
+    event_t evento;
+
+    while (debounce_ReadEvent(&evento)) {
+        sumidero += evento.edge;
+    }
+}
+
+/* Mantiene la instancia en su estado: tick fijo sin vencer el retardo */
+static void actualizarEstable(void * contexto, uint32_t iteraciones) {
+    debounce_t * debounce = contexto;
+    tick_t now = debounce->retardo.startTime + 1;
+
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        debounce_UpdateAt(debounce, now);
+    }
+    sumidero += debounce->estado;
+}
+
+/* Presión y liberación completas: cuatro actualizaciones por ciclo */
+static void actualizarCiclo(void * contexto, uint32_t iteraciones) {
+    debounce_t * debounce = contexto;
+    tick_t now = 0;
+
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        boton((i & 2u) == 0);
+        now += DELAY_MS(TIEMPO_RETARDO);
+        debounce_UpdateAt(debounce, now);
+        sumidero += debounce_ReadPressed(debounce) + debounce_ReadReleased(debounce);
+        if ((i & 63u) == 0) {
+            vaciarEventos();
+        }
+    }
+}
+
+static void contarEvento(const event_t * event, void * contexto) {
+    (void)contexto;
+    sumidero += event->edge;
+}
+
+/* Igual que el ciclo completo, pero los eventos llegan por los manejadores suscriptos */
+static void actualizarCicloSuscripto(void * contexto, uint32_t iteraciones) {
+    debounce_t * debounce = contexto;
+    tick_t now = 0;
+
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        boton((i & 2u) == 0);
+        now += DELAY_MS(TIEMPO_RETARDO);
+        debounce_UpdateAt(debounce, now);
+        if ((i & 63u) == 0) {
+            vaciarEventos();
+        }
+    }
+}
+
+static void escaladoIndividual(void * contexto, uint32_t iteraciones) {
+    escalado_t * escalado = contexto;
+
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        tick_t now = i;
+        for (uint32_t n = 0; n < escalado->cantidad; n++) {
+            debounce_UpdateAt(&escalado->instancias[n], now);
+        }
+    }
+}
+
+static void escaladoSnapshot(void * contexto, uint32_t iteraciones) {
+    escalado_t * escalado = contexto;
+    IO_Snapshot_t snapshot;
+
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        tick_t now = i;
+        IO_ReadMany(&snapshot);
+        for (uint32_t n = 0; n < escalado->cantidad; n++) {
+            debounce_UpdateSnapshotAt(&escalado->instancias[n], snapshot, now);
+        }
+    }
+}
+
+static void * esperarEventos(void * contexto) {
+    (void)contexto;
+    for (uint32_t i = 0; i < DESPERTARES; i++) {
+        if (debounce_WaitEvent(DELAY_MS(1000), IO_MASK(IO_BUTTON_USER)) == 0) {
+            break;
+        }
+        latenciasDespertar[i] = bench_Nanosegundos() - atomic_load(&marcaEvento);
+        atomic_store(&despertares, i + 1u);
+    }
+    return NULL;
+}
+
+static int compararLatencias(const void * a, const void * b) {
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* Latencia desde la actualización que confirma el evento hasta que vuelve el hilo bloqueado */
+static void medirDespertar(debounce_t * debounce) {
+    const struct timespec pausa = {0, 50000};
+    tick_t now = 0;
+    pthread_t hilo;
+    uint32_t medidos;
+
+    debounce_Init(debounce, IO_BUTTON_USER);
+    boton(false);
+    debounce_WaitEvent(0, IO_MASK(IO_BUTTON_USER));
+    atomic_store(&despertares, 0u);
+    if (pthread_create(&hilo, NULL, esperarEventos, NULL) != 0) {
+        return;
+    }
+    for (uint32_t i = 0; i < DESPERTARES; i++) {
+        /* Deja que el hilo vuelva a dormir en la espera antes del próximo evento */
+        nanosleep(&pausa, NULL);
+        boton((i & 1u) == 0);
+        debounce_UpdateAt(debounce, now);
+        now += DELAY_MS(TIEMPO_RETARDO) * 2;
+        atomic_store(&marcaEvento, bench_Nanosegundos());
+        debounce_UpdateAt(debounce, now);
+        /* Si el hilo no despierta, su espera vence y termina: no se sigue midiendo */
+        uint64_t limite = bench_Nanosegundos() + 2000000000ull;
+        while (atomic_load(&despertares) <= i && bench_Nanosegundos() < limite) {
+            sched_yield();
+        }
+        vaciarEventos();
+        if (atomic_load(&despertares) <= i) {
+            break;
+        }
+    }
+    pthread_join(hilo, NULL);
+
+    medidos = atomic_load(&despertares);
+    if (medidos == 0) {
+        return;
+    }
+    qsort(latenciasDespertar, medidos, sizeof(latenciasDespertar[0]), compararLatencias);
+    bench_Registrar("debounce", "despertar_p50_ns", 1, medidos,
+                    (double)latenciasDespertar[medidos / 2u], 0);
+    bench_Registrar("debounce", "despertar_p99_ns", 1, medidos,
+                    (double)latenciasDespertar[(uint64_t)medidos * 99u / 100u], 0);
+    printf("%-10s %-28s %6u %12.2f us p50 %12.2f us p99\n", "debounce", "despertar_wait_event",
+           medidos, latenciasDespertar[medidos / 2u] / 1e3,
+           latenciasDespertar[(uint64_t)medidos * 99u / 100u] / 1e3);
+}
+
+static void prepararEstado(debounce_t * debounce, debounceState_t estado) {
+    debounce_Init(debounce, IO_BUTTON_USER);
+    boton(false);
+    if (estado == BUTTON_UP) {
+        return;
+    }
+    boton(true);
+    debounce_UpdateAt(debounce, 0);
+    if (estado == BUTTON_FALLING) {
+        return;
+    }
+    debounce_UpdateAt(debounce, DELAY_MS(TIEMPO_RETARDO) * 2);
+    if (estado == BUTTON_DOWN) {
+        return;
+    }
+    boton(false);
+    debounce_UpdateAt(debounce, DELAY_MS(TIEMPO_RETARDO) * 3);
+}
+
+/* === Public function implementation ========================================================== */
+
+void benchDebounce(void) {
+    static const struct {
+        debounceState_t estado;
+        const char * nombre;
+    } estados[] = {
+        {BUTTON_UP, "update_BUTTON_UP"},
+        {BUTTON_FALLING, "update_BUTTON_FALLING"},
+        {BUTTON_DOWN, "update_BUTTON_DOWN"},
+        {BUTTON_RISING, "update_BUTTON_RISING"},
+    };
+    static const uint32_t cantidades[] = {1, 16, 256, MAX_ENTRADAS};
+    static char nombres[2][sizeof(cantidades) / sizeof(cantidades[0])][32];
+    debounce_t debounce;
+    escalado_t escalado = {.instancias = instancias};
+
+    IO_Init();
+
+    for (unsigned i = 0; i < sizeof(estados) / sizeof(estados[0]); i++) {
+        prepararEstado(&debounce, estados[i].estado);
+        bench_Medir("debounce", estados[i].nombre, 1, actualizarEstable, &debounce);
+    }
+
+    prepararEstado(&debounce, BUTTON_UP);
+    bench_Medir("debounce", "update_ciclo_completo", 1, actualizarCiclo, &debounce);
+    vaciarEventos();
+
+    prepararEstado(&debounce, BUTTON_UP);
+    debounce_Subscribe(&debounce, contarEvento, contarEvento, NULL);
+    bench_Medir("debounce", "update_ciclo_suscriptor", 1, actualizarCicloSuscripto, &debounce);
+    debounce_Unsubscribe(&debounce);
+    vaciarEventos();
+
+    medirDespertar(&debounce);
+
+    boton(false);
+    for (uint32_t n = 0; n < MAX_ENTRADAS; n++) {
+        debounce_Init(&instancias[n], IO_BUTTON_USER);
+    }
+    for (unsigned i = 0; i < sizeof(cantidades) / sizeof(cantidades[0]); i++) {
+        escalado.cantidad = cantidades[i];
+        snprintf(nombres[0][i], sizeof(nombres[0][i]), "escalado_io_read_%u", cantidades[i]);
+        snprintf(nombres[1][i], sizeof(nombres[1][i]), "escalado_snapshot_%u", cantidades[i]);
+        bench_Medir("debounce", nombres[0][i], cantidades[i], escaladoIndividual, &escalado);
+        bench_Medir("debounce", nombres[1][i], cantidades[i], escaladoSnapshot, &escalado);
+    }
+}
+
+/* === End of documentation ==================================================================== */
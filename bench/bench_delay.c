@@ -0,0 +1,136 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file bench_delay.c
+ * @brief Benchmarks de los caminos de API_delay
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "bench.h"
+#include "API_delay.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Retardos usados para medir el servicio de temporizadores */
+#define RETARDOS_SERVICIO 256
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+static volatile uint32_t sumidero;
+static delay_t retardos[RETARDOS_SERVICIO];
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* delayRead con un retardo detenido: camino que lo inicia (lee el tick) */
+static void leerIniciando(void * contexto, uint32_t iteraciones) {
+    delay_t * delay = contexto;
+
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        delay->running = false;
+        sumidero += delayRead(delay);
+    }
+}
+
+/* delayRead con un retardo en curso que no vence (lee el tick) */
+static void leerEnCurso(void * contexto, uint32_t iteraciones) {
+    delay_t * delay = contexto;
+
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        sumidero += delayRead(delay);
+    }
+}
+
+/* delayReadAt con un retardo en curso: sin acceso al tick */
+static void leerEnCursoAt(void * contexto, uint32_t iteraciones) {
+    delay_t * delay = contexto;
+
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        sumidero += delayReadAt(delay, delay->startTime + 1);
+    }
+}
+
+/* delayReadAt alternando vencimiento y reinicio */
+static void leerVencidoAt(void * contexto, uint32_t iteraciones) {
+    delay_t * delay = contexto;
+    tick_t now = 0;
+
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        now += delay->duration;
+        sumidero += delayReadAt(delay, now);
+    }
+}
+
+/* Servicio: reinicia un retardo y vence los debidos, con RETARDOS_SERVICIO registrados */
+static void servicioReiniciar(void * contexto, uint32_t iteraciones) {
+    tick_t now = 0;
+
+    (void)contexto;
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        now++;
+        delayStartAt(&retardos[i % RETARDOS_SERVICIO], NULL, now);
+        sumidero += delayProcessAt(now);
+    }
+}
+
+/* Servicio: consulta del próximo vencimiento */
+static void servicioProximo(void * contexto, uint32_t iteraciones) {
+    tick_t proximo = 0;
+
+    (void)contexto;
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        sumidero += delay_NextDeadline(&proximo);
+    }
+    sumidero += proximo;
+}
+
+/* === Public function implementation ========================================================== */
+
+void benchDelay(void) {
+    delay_t delay;
+
+    delayInit(&delay, 1000);
+    bench_Medir("delay", "delayRead_inicia", 1, leerIniciando, &delay);
+    delayInit(&delay, 2000);
+    delayRead(&delay);
+    bench_Medir("delay", "delayRead_en_curso", 1, leerEnCurso, &delay);
+    bench_Medir("delay", "delayReadAt_en_curso", 1, leerEnCursoAt, &delay);
+    delayInit(&delay, 50);
+    bench_Medir("delay", "delayReadAt_vence", 1, leerVencidoAt, &delay);
+
+    for (int i = 0; i < RETARDOS_SERVICIO; i++) {
+        delayInit(&retardos[i], 50 + (i * 7) % 1950);
+        delayStartAt(&retardos[i], NULL, 0);
+    }
+    bench_Medir("delay", "servicio_reiniciar_256", 1, servicioReiniciar, NULL);
+    bench_Medir("delay", "delay_NextDeadline", 1, servicioProximo, NULL);
+    for (int i = 0; i < RETARDOS_SERVICIO; i++) {
+        delayStop(&retardos[i]);
+    }
+}
+
+/* === End of documentation ==================================================================== */
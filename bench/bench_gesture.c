@@ -0,0 +1,94 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file bench_gesture.c
+ * @brief Costo de reconocer gestos: un click completo y una repetición de la pulsación larga
+ * @details El tiempo es virtual y los vencimientos los dispara delayProcessAt(), como en el lazo
+ * principal.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "bench.h"
+#include "API_gesture.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+/** @brief Evita que el compilador descarte los resultados */
+static volatile uint32_t sumidero;
+/** @brief Tiempo virtual compartido por los casos */
+static tick_t now;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void contar(gesture_t * gesture, gestureEvent_t evento, tick_t tick, void * contexto) {
+    (void)gesture;
+    (void)tick;
+    (void)contexto;
+    sumidero += evento;
+}
+
+static void click(void * contexto, uint32_t iteraciones) {
+    gesture_t * gesture = contexto;
+
+    for (uint32_t n = 0; n < iteraciones; n++) {
+        gesture_Feed(gesture, EVENT_PRESSED, now);
+        now += DELAY_MS(80);
+        gesture_Feed(gesture, EVENT_RELEASED, now);
+        now += DELAY_MS(GESTURE_DOBLE_MS);
+        delayProcessAt(now);
+    }
+}
+
+static void repeticion(void * contexto, uint32_t iteraciones) {
+    (void)contexto;
+    for (uint32_t n = 0; n < iteraciones; n++) {
+        now += DELAY_MS(GESTURE_REPETICION_MS);
+        delayProcessAt(now);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void benchGesture(void) {
+    static const gestureConfig_t config = GESTURE_CONFIG_DEFAULT(contar, NULL);
+    gesture_t gesture;
+
+    gesture_Init(&gesture, 0, &config);
+    bench_Medir("gesture", "click", 1, click, &gesture);
+
+    gesture_Feed(&gesture, EVENT_PRESSED, now);
+    now += DELAY_MS(GESTURE_LARGA_MS);
+    delayProcessAt(now);
+    bench_Medir("gesture", "repeticion", 1, repeticion, &gesture);
+    gesture_Reset(&gesture);
+}
+
+/* === End of documentation ==================================================================== */
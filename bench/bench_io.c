@@ -0,0 +1,139 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file bench_io.c
+ * @brief Benchmarks de API_IO sobre la HAL emulada
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "bench.h"
+#include "main.h"
+#include "API_IO.h"
+#include "API_IO_inline.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+static volatile uint32_t sumidero;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void leer(void * contexto, uint32_t iteraciones) {
+    bool estado;
+
+    (void)contexto;
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        IO_Read(IO_BUTTON_USER, &estado);
+        sumidero += estado;
+    }
+}
+
+static void leerEnLinea(void * contexto, uint32_t iteraciones) {
+    (void)contexto;
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        sumidero += IO_BUTTON_USER_Read();
+    }
+}
+
+static void leerPuerto(void * contexto, uint32_t iteraciones) {
+    uint16_t valor;
+
+    (void)contexto;
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        IO_ReadPort(IO_BUTTON_USER, &valor);
+        sumidero += valor;
+    }
+}
+
+static void leerTodos(void * contexto, uint32_t iteraciones) {
+    IO_Snapshot_t snapshot;
+
+    (void)contexto;
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        IO_ReadMany(&snapshot);
+        sumidero += snapshot;
+    }
+}
+
+static void escribir(void * contexto, uint32_t iteraciones) {
+    (void)contexto;
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        IO_Write(IO_LED_DEBUG, i & 1u);
+    }
+}
+
+static void escribirIgual(void * contexto, uint32_t iteraciones) {
+    (void)contexto;
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        IO_Write(IO_LED_DEBUG, true);
+    }
+}
+
+static void escribirEnLinea(void * contexto, uint32_t iteraciones) {
+    (void)contexto;
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        IO_LED_DEBUG_Write(i & 1u);
+    }
+}
+
+static void escribirAgrupado(void * contexto, uint32_t iteraciones) {
+    (void)contexto;
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        IO_Snapshot_t todos = IO_MASK(IO_LED_DEBUG) | IO_MASK(IO_BUTTON_USER);
+
+        IO_WriteMask((i & 1u) ? todos : 0, (i & 1u) ? 0 : todos);
+        IO_Flush();
+    }
+}
+
+static void invertir(void * contexto, uint32_t iteraciones) {
+    (void)contexto;
+    for (uint32_t i = 0; i < iteraciones; i++) {
+        IO_Toggle(IO_LED_DEBUG);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void benchIO(void) {
+    IO_Init();
+
+    bench_Medir("io", "IO_Read", 1, leer, NULL);
+    bench_Medir("io", "IO_BUTTON_USER_Read", 1, leerEnLinea, NULL);
+    bench_Medir("io", "IO_ReadPort", 1, leerPuerto, NULL);
+    bench_Medir("io", "IO_ReadMany", IO_DEVICE_COUNT, leerTodos, NULL);
+    bench_Medir("io", "IO_Write", 1, escribir, NULL);
+    bench_Medir("io", "IO_Write sin cambio", 1, escribirIgual, NULL);
+    bench_Medir("io", "IO_LED_DEBUG_Write", 1, escribirEnLinea, NULL);
+    bench_Medir("io", "IO_WriteMask+IO_Flush", 2, escribirAgrupado, NULL);
+    bench_Medir("io", "IO_Toggle", 1, invertir, NULL);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,106 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file bench_matrix.c
+ * @brief Costo de un barrido del teclado de 4x4 y barridos por segundo
+ * @details Las filas se calculan a partir de las columnas activas, como en una matriz sin diodos,
+ * durante la espera entre columnas. Se mide con las teclas sueltas, con dos teclas presionadas y
+ * con un rectángulo que obliga a descartar fantasmas.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "bench.h"
+#include "main.h"
+#include "API_matrix.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Lado del teclado */
+#define LADO 4
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+static const IO_Device_t columnas[LADO] = MATRIX_KEYPAD_COLUMNS;
+static const IO_Device_t filas[LADO] = MATRIX_KEYPAD_ROWS;
+/** @brief Teclas presionadas, un bit por columna en cada fila */
+static uint8_t presionadas[LADO];
+/** @brief Evita que el compilador descarte los resultados */
+static volatile uint32_t sumidero;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void simularMatriz(void * contexto) {
+    uint8_t columnasActivas = (uint8_t)(GPIOA->ODR & 0x0Fu);
+    uint8_t filasActivas = 0;
+    uint8_t anterior;
+
+    (void)contexto;
+    do {
+        anterior = filasActivas;
+        for (int f = 0; f < LADO; f++) {
+            if (presionadas[f] & columnasActivas) {
+                filasActivas |= (uint8_t)(1u << f);
+                columnasActivas |= presionadas[f];
+            }
+        }
+    } while (filasActivas != anterior);
+    GPIOA->IDR = (uint32_t)filasActivas << 4;
+}
+
+static void barrer(void * contexto, uint32_t iteraciones) {
+    matrix_t * matrix = contexto;
+    matrixReport_t reporte;
+    static tick_t now;
+
+    for (uint32_t n = 0; n < iteraciones; n++) {
+        now += DELAY_MS(1);
+        sumidero += matrix_Scan(matrix, now, &reporte);
+    }
+}
+
+static void medir(const char * caso, uint8_t fila0, uint8_t fila1) {
+    static matrix_t matrix;
+
+    presionadas[0] = fila0;
+    presionadas[1] = fila1;
+    matrix_Init(&matrix, columnas, LADO, filas, LADO, DELAY_MS(TIEMPO_RETARDO));
+    matrix_SetSettle(&matrix, simularMatriz, NULL);
+    bench_Medir("matrix", caso, LADO * LADO, barrer, &matrix);
+}
+
+/* === Public function implementation ========================================================== */
+
+void benchMatrix(void) {
+    IO_Init();
+
+    medir("4x4 sin teclas", 0, 0);
+    medir("4x4 dos teclas", 0x01u, 0x02u);
+    medir("4x4 con fantasma", 0x03u, 0x01u);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,98 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file bench_scheduler.c
+ * @brief Costo de una pasada del planificador: sin activaciones y despachando ocho tareas
+ * @details El tiempo es virtual: el reloj de los retardos se reemplaza con delay_SetClock() y cada
+ * llamada avanza un tick, así que se mide solo el planificador y el servicio de temporizadores.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "bench.h"
+#include "API_scheduler.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Tareas registradas en el caso de despacho */
+#define TAREAS 8
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+/** @brief Evita que el compilador descarte los resultados */
+static volatile uint32_t sumidero;
+/** @brief Tiempo virtual de los retardos */
+static tick_t now;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static tick_t leerReloj(void) {
+    return now;
+}
+
+static schedulerResult_t contar(schedulerTask_t * tarea, void * contexto) {
+    (void)tarea;
+    (void)contexto;
+    sumidero++;
+    return SCHEDULER_DONE;
+}
+
+static void pasada(void * contexto, uint32_t iteraciones) {
+    (void)contexto;
+    for (uint32_t n = 0; n < iteraciones; n++) {
+        now++;
+        sumidero += scheduler_Run();
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void benchScheduler(void) {
+    static schedulerTask_t tareas[TAREAS];
+
+    delay_SetClock(leerReloj);
+    scheduler_Init();
+
+    /* Períodos largos: la pasada solo consulta el próximo vencimiento */
+    for (uint8_t i = 0; i < TAREAS; i++) {
+        scheduler_Add(&tareas[i], contar, NULL, DELAY_MAX, 0, 0);
+    }
+    scheduler_Run();
+    bench_Medir("scheduler", "pasada_ociosa", TAREAS, pasada, NULL);
+
+    /* Períodos de 1 a TAREAS ticks: en cada pasada se activan y despachan varias tareas */
+    scheduler_Init();
+    for (uint8_t i = 0; i < TAREAS; i++) {
+        scheduler_Add(&tareas[i], contar, NULL, i + 1, 0, 0);
+    }
+    bench_Medir("scheduler", "pasada_despacho", TAREAS, pasada, NULL);
+
+    scheduler_Init();
+    delay_SetClock(NULL);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,226 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file bench_service.c
+ * @brief Muestras por segundo y latencia p99 de API_debounceService según la cantidad de hilos
+ * @details Un productor encola MUESTRAS cambios sobre ENTRADAS entradas virtuales, la mitad
+ * concentrada en la primera dieciseisava parte para que haya un shard caliente y se note el robo
+ * de trabajo. El retardo es 0, así la latencia de cada evento es el tiempo entre que se encoló la
+ * muestra y que el manejador recibe el flanco: la espera en la cola más el procesamiento. El
+ * productor encola sin pausa, por lo que la p99 corresponde al servicio saturado.
+ *
+ * Cada muestra invierte su entrada, así que el k-ésimo flanco de una entrada viene de su k-ésima
+ * muestra. Las muestras de cada entrada se encadenan antes de la corrida y el manejador sigue la
+ * cadena para medir contra la marca de la muestra que produjo el flanco.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bench.h"
+#include "API_debounceService.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Entradas virtuales del servicio */
+#define ENTRADAS 200000u
+/** @brief Muestras encoladas en cada corrida */
+#define MUESTRAS 2000000u
+/** @brief Entradas de la zona caliente */
+#define ENTRADAS_CALIENTES (ENTRADAS / 16u)
+/** @brief Paso entre entradas consecutivas, coprimo con ambas zonas para recorrerlas completas */
+#define PASO 7919u
+/** @brief Esperas de 100 us para recibir los flancos de las últimas muestras */
+#define ESPERAS_FINALES 10000
+/** @brief Mayor cantidad de corridas, una por cantidad de hilos */
+#define MAX_CORRIDAS 16
+/** @brief Fin de la cadena de muestras de una entrada */
+#define SIN_MUESTRA UINT32_MAX
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+/** @brief Instante en que se encoló cada muestra, 0 mientras no se encoló */
+static _Atomic uint64_t * marcas;
+/** @brief Próxima muestra de la misma entrada, o SIN_MUESTRA */
+static uint32_t * siguientes;
+/** @brief Muestra que producirá el próximo flanco de cada entrada */
+static atomic_uint * cursores;
+/** @brief Latencia de cada evento medido */
+static uint64_t * latencias;
+/** @brief Latencias guardadas en la corrida */
+static atomic_uint cantidadLatencias;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void medirLatencia(const debounceServiceEvent_t * event, void * contexto) {
+    uint64_t ahora = bench_Nanosegundos();
+    /* Los flancos de una entrada los entrega un solo hilo a la vez, el que tiene su shard */
+    unsigned int muestra = atomic_load_explicit(&cursores[event->entrada], memory_order_relaxed);
+    uint64_t marca;
+    unsigned int posicion;
+
+    (void)contexto;
+    if (muestra == SIN_MUESTRA) {
+        return;
+    }
+    atomic_store_explicit(&cursores[event->entrada], siguientes[muestra], memory_order_relaxed);
+    marca = atomic_load_explicit(&marcas[muestra], memory_order_acquire);
+    if (marca == 0 || ahora < marca) {
+        return;
+    }
+    posicion = atomic_fetch_add_explicit(&cantidadLatencias, 1u, memory_order_relaxed);
+    if (posicion < MUESTRAS) {
+        latencias[posicion] = ahora - marca;
+    }
+}
+
+static int compararLatencias(const void * a, const void * b) {
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* Una muestra de cada dos va a la zona caliente, las demás al resto de las entradas */
+static uint32_t elegirEntrada(uint32_t muestra) {
+    uint32_t vuelta = muestra / 2u;
+
+    if (muestra & 1u) {
+        return (vuelta * PASO) % ENTRADAS_CALIENTES;
+    }
+    return ENTRADAS_CALIENTES + (vuelta * PASO) % (ENTRADAS - ENTRADAS_CALIENTES);
+}
+
+static void correr(uint8_t hilos, const char * casoMuestras, const char * casoLatencia) {
+    static uint8_t niveles[ENTRADAS];
+    debounceServiceConfig_t config = {ENTRADAS, hilos, 0, medirLatencia, NULL};
+    const struct timespec espera = {0, 100000};
+    debounceService_t service;
+    debounceServiceStats_t stats;
+    uint64_t inicio;
+    uint64_t ns;
+    uint32_t medidas;
+    uint64_t p99;
+
+    if (!debounceService_Init(&service, &config)) {
+        return;
+    }
+    for (uint32_t i = 0; i < ENTRADAS; i++) {
+        niveles[i] = 0;
+        atomic_store_explicit(&cursores[i], SIN_MUESTRA, memory_order_relaxed);
+    }
+    /* Encadena las muestras de cada entrada desde la última, el cursor queda en la primera */
+    for (uint32_t muestra = MUESTRAS; muestra-- > 0;) {
+        uint32_t entrada = elegirEntrada(muestra);
+
+        siguientes[muestra] = atomic_load_explicit(&cursores[entrada], memory_order_relaxed);
+        atomic_store_explicit(&cursores[entrada], muestra, memory_order_relaxed);
+        atomic_store_explicit(&marcas[muestra], 0, memory_order_relaxed);
+    }
+    atomic_store(&cantidadLatencias, 0u);
+    debounceService_Start(&service);
+
+    inicio = bench_Nanosegundos();
+    for (uint32_t muestra = 0; muestra < MUESTRAS; muestra++) {
+        uint32_t entrada = elegirEntrada(muestra);
+
+        niveles[entrada] ^= 1u;
+        atomic_store_explicit(&marcas[muestra], bench_Nanosegundos(), memory_order_release);
+        while (!debounceService_Push(&service, entrada, niveles[entrada])) {
+            sched_yield();
+        }
+    }
+    do {
+        nanosleep(&espera, NULL);
+        debounceService_GetStats(&service, &stats);
+    } while (stats.muestras < MUESTRAS);
+    ns = bench_Nanosegundos() - inicio;
+    /* Cada muestra invierte su entrada: los últimos flancos se confirman en la vuelta siguiente */
+    for (int i = 0; i < ESPERAS_FINALES && stats.eventos < MUESTRAS; i++) {
+        nanosleep(&espera, NULL);
+        debounceService_GetStats(&service, &stats);
+    }
+    debounceService_Destroy(&service);
+
+    medidas = atomic_load(&cantidadLatencias);
+    medidas = medidas < MUESTRAS ? medidas : MUESTRAS;
+    qsort(latencias, medidas, sizeof(latencias[0]), compararLatencias);
+    p99 = medidas > 0 ? latencias[(uint64_t)medidas * 99u / 100u] : 0;
+
+    bench_Registrar("service", casoMuestras, 1, MUESTRAS, (double)ns / MUESTRAS, 0);
+    bench_Registrar("service", casoLatencia, 1, medidas, (double)p99, 0);
+    printf("%-10s %3u hilos %14.0f muestras/s  p99 %10.1f us  eventos %8llu  robadas %5.1f %%"
+           "  descartes %llu\n",
+           "service", hilos, 1e9 * MUESTRAS / ns, p99 / 1e3, (unsigned long long)stats.eventos,
+           100.0 * stats.robadas / MUESTRAS, (unsigned long long)stats.descartadas);
+}
+
+/* === Public function implementation ========================================================== */
+
+void benchService(void) {
+    static char nombres[MAX_CORRIDAS][2][32];
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+    uint8_t hilos[MAX_CORRIDAS];
+    uint8_t corridas = 0;
+
+    if (nucleos < 1) {
+        nucleos = 1;
+    }
+    /* 1, 2, 4, ... hasta la cantidad de núcleos, que siempre se mide */
+    for (long n = 1; n < nucleos && n <= UINT8_MAX && corridas < MAX_CORRIDAS - 1; n *= 2) {
+        hilos[corridas++] = (uint8_t)n;
+    }
+    hilos[corridas++] = (uint8_t)(nucleos <= UINT8_MAX ? nucleos : UINT8_MAX);
+
+    marcas = malloc(MUESTRAS * sizeof(marcas[0]));
+    siguientes = malloc(MUESTRAS * sizeof(siguientes[0]));
+    cursores = malloc(ENTRADAS * sizeof(cursores[0]));
+    latencias = malloc(MUESTRAS * sizeof(latencias[0]));
+    if (marcas == NULL || siguientes == NULL || cursores == NULL || latencias == NULL) {
+        free(marcas);
+        free(siguientes);
+        free(cursores);
+        free(latencias);
+        return;
+    }
+    for (uint8_t i = 0; i < corridas; i++) {
+        snprintf(nombres[i][0], sizeof(nombres[i][0]), "hilos_%u_ns_por_muestra", hilos[i]);
+        snprintf(nombres[i][1], sizeof(nombres[i][1]), "hilos_%u_latencia_p99_ns", hilos[i]);
+        correr(hilos[i], nombres[i][0], nombres[i][1]);
+    }
+    free(marcas);
+    free(siguientes);
+    free(cursores);
+    free(latencias);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,121 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file bench_vcounter.c
+ * @brief Comparación de costo por entrada entre la FSM de antirrebote y los contadores verticales
+ * @details Ambos motores procesan las mismas muestras con rebotes. La FSM recibe la muestra como
+ * snapshot y el tiempo explícito, igual que en un lazo con debounce_UpdateSnapshotAt().
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "bench.h"
+#include "API_debounce.h"
+#include "API_vcounter.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Cantidad de muestras distintas precalculadas */
+#define MUESTRAS 1024
+/** @brief Cantidad de entradas comparadas */
+#define ENTRADAS VCOUNTER_WIDTH
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+/** @brief Muestras con rebotes simulados, una entrada por bit */
+static vcounter_word_t muestras[MUESTRAS];
+/** @brief Evita que el compilador descarte los resultados */
+static volatile vcounter_word_t sumidero;
+/** @brief Una instancia de la FSM por entrada */
+static debounce_t botones[ENTRADAS];
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void generarMuestras(void) {
+    uint32_t semilla = 0x12345678u;
+    vcounter_word_t estable = 0;
+
+    for (int i = 0; i < MUESTRAS; i++) {
+        semilla ^= semilla << 13;
+        semilla ^= semilla >> 17;
+        semilla ^= semilla << 5;
+        /* Cada tanto cambia el estado estable y se agrega ruido en pocas entradas */
+        if ((i % 64) == 0) {
+            estable ^= (vcounter_word_t)semilla;
+        }
+        muestras[i] = estable ^ ((vcounter_word_t)semilla & (vcounter_word_t)(semilla >> 7) &
+                                 (vcounter_word_t)(semilla >> 19));
+    }
+}
+
+static void medirFSM(void * contexto, uint32_t iteraciones) {
+    tick_t now = 0;
+    event_t evento;
+
+    (void)contexto;
+    for (uint32_t n = 0; n < iteraciones; n++) {
+        /* Cada instancia ve su entrada en el bit IO_BUTTON_USER del snapshot */
+        vcounter_word_t muestra = muestras[n % MUESTRAS];
+
+        now += DELAY_MS(TIEMPO_RETARDO) / VCOUNTER_MUESTRAS;
+        for (int i = 0; i < ENTRADAS; i++) {
+            IO_Snapshot_t snapshot = (IO_Snapshot_t)((muestra >> i) & 1u) << IO_BUTTON_USER;
+            debounce_UpdateSnapshotAt(&botones[i], snapshot, now);
+            sumidero ^= debounce_ReadPressed(&botones[i]);
+        }
+        while (debounce_ReadEvent(&evento)) {
+            sumidero ^= evento.edge;
+        }
+    }
+}
+
+static void medirVcounter(void * contexto, uint32_t iteraciones) {
+    vcounter_t * vcounter = contexto;
+    vcounter_word_t pressed, released;
+
+    for (uint32_t n = 0; n < iteraciones; n++) {
+        vcounter_Update(vcounter, muestras[n % MUESTRAS], &pressed, &released);
+        sumidero ^= pressed;
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void benchVcounter(void) {
+    vcounter_t vcounter;
+
+    generarMuestras();
+    for (int i = 0; i < ENTRADAS; i++) {
+        debounce_Init(&botones[i], IO_BUTTON_USER);
+    }
+    vcounter_Init(&vcounter, 0);
+
+    bench_Medir("vcounter", "fsm", ENTRADAS, medirFSM, NULL);
+    bench_Medir("vcounter", "vcounter", ENTRADAS, medirVcounter, &vcounter);
+}
+
+/* === End of documentation ==================================================================== */
@@ -36,6 +36,8 @@ SPDX-License-Identifier: MIT
 #include <stdbool.h>
 #endif
 
+#include "API_IO_devices.h"
+
 /* === Cabecera C++ ============================================================================ */
 
 #ifdef __cplusplus
@@ -59,28 +61,53 @@ extern "C" {
 #define GPIO_PIN_RESET 0
 #endif
 
+/**
+ * @def IO_SNAPSHOT_STATE
+ * @brief Extrae el estado de un dispositivo de una lectura obtenida con IO_ReadMany()
+ */
+#define IO_SNAPSHOT_STATE(snapshot, device) ((((snapshot) >> (device)) & 1u) != 0)
+
+/**
+ * @def IO_MASK
+ * @brief Bit de un dispositivo dentro de un IO_Snapshot_t, para armar máscaras de IO_WriteMask()
+ */
+#define IO_MASK(device) ((IO_Snapshot_t)1u << (device))
+
+/** @brief Genera un enumerador de IO_Device_t por cada entrada de IO_DEVICE_TABLE */
+#define IO_DEVICE_ENUM(nombre, puerto, pin) nombre,
+
 /* === Public data type declarations =========================================================== */
 /**
  * @enum IO_Device_t
- * @brief Dispositivos GPIO disponibles
+ * @brief Dispositivos GPIO disponibles, definidos en IO_DEVICE_TABLE
  */
-typedef enum {
-    IO_BUTTON_USER, // Botón de usuario (PB10)
-    IO_LED_DEBUG,   // LED de debug (PC13)
-    IO_DEVICE_COUNT
-} IO_Device_t;
+typedef enum { IO_DEVICE_TABLE(IO_DEVICE_ENUM) IO_DEVICE_COUNT } IO_Device_t;
 
 /**
  * @enum IO_Status_t
  * @brief Resultados de operaciones GPIO
  */
 typedef enum { IO_OK, IO_ERROR, IO_INVALID_DEVICE } IO_Status_t;
+
+/**
+ * @typedef IO_Snapshot_t
+ * @brief Estado de todos los dispositivos empaquetado en un bit por IO_Device_t
+ */
+typedef uint32_t IO_Snapshot_t;
+
+/**
+ * @typedef IO_ReadHook_t
+ * @brief Función que recibe cada lectura de entradas, por ejemplo para grabar una traza
+ * @param snapshot Último estado conocido de todos los dispositivos
+ */
+typedef void (*IO_ReadHook_t)(IO_Snapshot_t snapshot);
 /* === Public variable declarations ============================================================ */
 
 /* === Public function declarations ============================================================ */
 /**
  * @brief Inicializa el módulo de GPIO
- * @note Configura el estado inicial del LED (apagado)
+ * @note Configura el estado inicial del LED (apagado), precalcula la tabla de puertos usada
+ * por IO_ReadMany() e IO_Flush() y olvida la copia de salidas y los cambios pendientes
  */
 void IO_Init(void);
 
@@ -93,18 +120,66 @@ void IO_Init(void);
     */
 IO_Status_t IO_Read(IO_Device_t device, bool * state);
 
+/**
+  * @brief Lee de una sola vez el registro de entrada del puerto de un dispositivo
+  * @param device Dispositivo cuyo puerto se quiere leer
+  * @param value Puntero donde se almacenará el valor del puerto (un bit por pin)
+  * @return Resultado de la operación (IO_OK si la operación fue exitosa,
+    IO_INVALID_DEVICE si el dispositivo no existe, IO_ERROR si el puntero value es NULL)
+  */
+IO_Status_t IO_ReadPort(IO_Device_t device, uint16_t * value);
+
+/**
+  * @brief Lee el estado de todos los dispositivos leyendo una vez cada puerto utilizado
+  * @param snapshot Puntero donde se almacenará un bit por IO_Device_t
+  * @return Resultado de la operación (IO_OK si la operación fue exitosa,
+    IO_ERROR si el puntero snapshot es NULL o no se llamó a IO_Init)
+  */
+IO_Status_t IO_ReadMany(IO_Snapshot_t * snapshot);
+
+/**
+  * @brief Instala una función que se llama después de cada lectura de entradas
+  * @param hook Función a llamar, o NULL para quitarla
+  * @note IO_ReadMany() entrega la lectura completa; IO_Read() entrega la última lectura conocida
+    con el bit del dispositivo leído actualizado
+  */
+void IO_SetReadHook(IO_ReadHook_t hook);
+
 /**
   * @brief Escribe un estado en un dispositivo GPIO
   * @param device Dispositivo a escribir
   * @param state Estado a escribir (true=HIGH, false=LOW)
   * @return Resultado de la operación (IO_OK si la operación fue exitosa,
     IO_INVALID_DEVICE si el dispositivo no existe)
+  * @note Si el pin ya tiene el estado pedido según la copia de salidas que mantiene el módulo,
+    no se accede al puerto. Descarta un cambio del mismo dispositivo pendiente de IO_Flush()
   */
 IO_Status_t IO_Write(IO_Device_t device, bool state);
 
+/**
+  * @brief Agenda el encendido y el apagado de varios dispositivos para el próximo IO_Flush()
+  * @param set Dispositivos a poner en alto, un bit por IO_Device_t (ver IO_MASK)
+  * @param reset Dispositivos a poner en bajo, un bit por IO_Device_t
+  * @return Resultado de la operación (IO_OK si la operación fue exitosa,
+    IO_INVALID_DEVICE si alguna máscara tiene bits fuera de IO_DEVICE_COUNT, IO_ERROR si un
+    dispositivo está a la vez en set y en reset)
+  * @note Llamadas sucesivas se acumulan y la última gana para cada dispositivo
+  */
+IO_Status_t IO_WriteMask(IO_Snapshot_t set, IO_Snapshot_t reset);
+
+/**
+  * @brief Aplica los cambios agendados con IO_WriteMask()
+  * @return Cantidad de puertos escritos
+  * @details Agrupa los cambios por puerto, descarta los pines que ya tienen el estado pedido y
+    escribe cada puerto con un único acceso atómico al registro BSRR. Pensada para llamarse una vez
+    por vuelta del lazo principal
+  */
+uint8_t IO_Flush(void);
+
 /**
   * @brief Cambia el estado de un dispositivo GPIO
   * @param device Dispositivo a cambiar
+  * @note Siempre accede al puerto; descarta un cambio del mismo dispositivo pendiente de IO_Flush()
   * @return Resultado de la operación(IO_OK si la operación fue exitosa,
     IO_INVALID_DEVICE si el dispositivo no existe)
   */
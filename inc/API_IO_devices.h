@@ -0,0 +1,87 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+#ifndef API_IO_DEVICES_H
+#define API_IO_DEVICES_H
+/**
+ * @file API_IO_devices.h
+ * @brief Tabla de dispositivos GPIO, única fuente de IO_Device_t, del mapeo a pines y de los
+ * accesos en línea de API_IO_inline.h
+ * @details Para agregar un dispositivo basta una línea X(nombre, puerto, pin). Se mantiene fuera
+ * de API_IO.h para que CMock no tenga que procesar la macro
+ * @date 2025
+ * @author Veronica Ruíz Galván
+ */
+
+/* === Headers files inclusions ================================================================ */
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+/**
+ * @def IO_KEYPAD
+ * @brief En 1 agrega las columnas y filas del teclado matricial de 4x4 usado por API_matrix
+ */
+#ifndef IO_KEYPAD
+#define IO_KEYPAD 0
+#endif
+
+#if IO_KEYPAD
+/**
+ * @def IO_KEYPAD_TABLE
+ * @brief Columnas (salidas, activas en alto) y filas (entradas con pull-down) del teclado, en GPIOA
+ */
+#define IO_KEYPAD_TABLE(X)                                                                         \
+    X(IO_KEY_COL0, GPIOA, GPIO_PIN_0)                                                              \
+    X(IO_KEY_COL1, GPIOA, GPIO_PIN_1)                                                              \
+    X(IO_KEY_COL2, GPIOA, GPIO_PIN_2)                                                              \
+    X(IO_KEY_COL3, GPIOA, GPIO_PIN_3)                                                              \
+    X(IO_KEY_ROW0, GPIOA, GPIO_PIN_4)                                                              \
+    X(IO_KEY_ROW1, GPIOA, GPIO_PIN_5)                                                              \
+    X(IO_KEY_ROW2, GPIOA, GPIO_PIN_6)                                                              \
+    X(IO_KEY_ROW3, GPIOA, GPIO_PIN_7)
+#else
+#define IO_KEYPAD_TABLE(X)
+#endif
+
+/**
+ * @def IO_DEVICE_TABLE
+ * @brief Aplica X(nombre, puerto, pin) a cada dispositivo, en el orden de IO_Device_t
+ */
+#define IO_DEVICE_TABLE(X)                                                                         \
+    X(IO_BUTTON_USER, BUTTON_PORT, BUTTON_PIN) /* Botón de usuario (PB3) */                        \
+    X(IO_LED_DEBUG, LED_PORT, LED_PIN)         /* LED de debug (PC13) */                           \
+    IO_KEYPAD_TABLE(X)
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* API_IO_DEVICES_H */
@@ -0,0 +1,192 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+#ifndef API_IO_INLINE_H
+#define API_IO_INLINE_H
+/**
+ * @file API_IO_inline.h
+ * @brief Accesos en línea a los dispositivos de IO_DEVICE_TABLE, sin llamadas ni validaciones
+ * @details Por cada dispositivo se generan nombre_Read(), nombre_Write() y nombre_Toggle(): el
+ * puerto y el pin son constantes, así que con optimización cada uno queda en un acceso directo al
+ * registro y un dispositivo inexistente no compila. IO_ReadFast(), IO_WriteFast() e
+ * IO_ToggleFast() aceptan el dispositivo como variable pero no lo validan. Comparten con API_IO.c
+ * la copia de salidas, los cambios pendientes de IO_Flush() y la función de lectura, así que se
+ * pueden mezclar con la API validada de API_IO.h.
+ * @date 2025
+ * @author Veronica Ruíz Galván
+ */
+
+/* === Headers files inclusions ================================================================ */
+#include "main.h"
+#include "API_IO.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+#ifndef GPIO_WRITE_BSRR
+/**
+ * @brief Escribe en un solo acceso los pines a poner en alto (16 bits bajos) y en bajo (16 bits
+ * altos) de un puerto
+ */
+#define GPIO_WRITE_BSRR(GPIOx, valor) ((GPIOx)->BSRR = (valor))
+#endif
+
+/* === Public data type declarations =========================================================== */
+/**
+ * @struct io_state_t
+ * @brief Estado de API_IO compartido con los accesos en línea
+ */
+typedef struct {
+    IO_Snapshot_t outputs;      /**< Último estado escrito, válido en los bits de outputsKnown */
+    IO_Snapshot_t outputsKnown; /**< Salidas escritas desde IO_Init() */
+    IO_Snapshot_t pendingSet;   /**< Dispositivos a poner en alto en el próximo IO_Flush() */
+    IO_Snapshot_t pendingReset; /**< Dispositivos a poner en bajo en el próximo IO_Flush() */
+    IO_ReadHook_t readHook;     /**< Función llamada después de cada lectura, NULL si no hay */
+} io_state_t;
+
+/* === Public variable declarations ============================================================ */
+/** @brief Estado de API_IO, de uso interno de este archivo y de API_IO.c */
+extern io_state_t io_state;
+
+/* === Public function declarations ============================================================ */
+/**
+ * @brief Informa una lectura a la función instalada con IO_SetReadHook()
+ * @note Fuera de línea: solo se llama si hay una función instalada
+ */
+void io_notifyRead(IO_Device_t device, bool state);
+
+/**
+ * @brief Lee un pin e informa la lectura si hay una función de lectura instalada
+ */
+static inline bool io_readPin(IO_Device_t device, GPIO_TypeDef * port, uint16_t pin) {
+    bool state = (port->IDR & pin) != 0;
+
+    if (io_state.readHook != NULL) {
+        io_notifyRead(device, state);
+    }
+    return state;
+}
+
+/**
+ * @brief Escribe un pin salvo que la copia de salidas indique que ya tiene ese estado
+ * @note Descarta un cambio del mismo dispositivo pendiente de IO_Flush()
+ */
+static inline void io_writePin(IO_Device_t device, GPIO_TypeDef * port, uint16_t pin, bool state) {
+    IO_Snapshot_t mask = IO_MASK(device);
+
+    io_state.pendingSet &= ~mask;
+    io_state.pendingReset &= ~mask;
+    if ((io_state.outputsKnown & mask) && (((io_state.outputs & mask) != 0) == state))
+        return;
+
+    GPIO_WRITE_BSRR(port, state ? (uint32_t)pin : (uint32_t)pin << 16);
+    io_state.outputs = state ? (io_state.outputs | mask) : (io_state.outputs & ~mask);
+    io_state.outputsKnown |= mask;
+}
+
+/**
+ * @brief Invierte un pin a partir del registro de salida y actualiza la copia de salidas
+ * @note Descarta un cambio del mismo dispositivo pendiente de IO_Flush()
+ */
+static inline void io_togglePin(IO_Device_t device, GPIO_TypeDef * port, uint16_t pin) {
+    IO_Snapshot_t mask = IO_MASK(device);
+    bool state = (port->ODR & pin) == 0;
+
+    io_state.pendingSet &= ~mask;
+    io_state.pendingReset &= ~mask;
+    GPIO_WRITE_BSRR(port, state ? (uint32_t)pin : (uint32_t)pin << 16);
+    io_state.outputs = state ? (io_state.outputs | mask) : (io_state.outputs & ~mask);
+    io_state.outputsKnown |= mask;
+}
+
+/** @brief Genera nombre_Read(), nombre_Write() y nombre_Toggle() para un dispositivo */
+#define IO_DEVICE_ACCESSORS(nombre, puerto, pin)                                                   \
+    static inline bool nombre##_Read(void) {                                                       \
+        return io_readPin(nombre, puerto, pin);                                                    \
+    }                                                                                              \
+    static inline void nombre##_Write(bool state) {                                                \
+        io_writePin(nombre, puerto, pin, state);                                                   \
+    }                                                                                              \
+    static inline void nombre##_Toggle(void) {                                                     \
+        io_togglePin(nombre, puerto, pin);                                                         \
+    }
+
+IO_DEVICE_TABLE(IO_DEVICE_ACCESSORS)
+
+/**
+ * @brief Lee un dispositivo sin validarlo
+ * @param device Dispositivo a leer; si no existe se devuelve false
+ */
+static inline bool IO_ReadFast(IO_Device_t device) {
+    switch (device) {
+#define IO_READ_CASE(nombre, puerto, pin)                                                          \
+    case nombre:                                                                                   \
+        return io_readPin(nombre, puerto, pin);
+        IO_DEVICE_TABLE(IO_READ_CASE)
+#undef IO_READ_CASE
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Escribe un dispositivo sin validarlo
+ * @param device Dispositivo a escribir; si no existe no se hace nada
+ * @param state Estado a escribir (true=HIGH, false=LOW)
+ */
+static inline void IO_WriteFast(IO_Device_t device, bool state) {
+    switch (device) {
+#define IO_WRITE_CASE(nombre, puerto, pin)                                                         \
+    case nombre:                                                                                   \
+        io_writePin(nombre, puerto, pin, state);                                                   \
+        break;
+        IO_DEVICE_TABLE(IO_WRITE_CASE)
+#undef IO_WRITE_CASE
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Invierte un dispositivo sin validarlo
+ * @param device Dispositivo a invertir; si no existe no se hace nada
+ */
+static inline void IO_ToggleFast(IO_Device_t device) {
+    switch (device) {
+#define IO_TOGGLE_CASE(nombre, puerto, pin)                                                        \
+    case nombre:                                                                                   \
+        io_togglePin(nombre, puerto, pin);                                                         \
+        break;
+        IO_DEVICE_TABLE(IO_TOGGLE_CASE)
+#undef IO_TOGGLE_CASE
+    default:
+        break;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* API_IO_INLINE_H */
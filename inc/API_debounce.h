@@ -39,6 +39,7 @@ SPDX-License-Identifier: MIT
 
 #include "API_delay.h"
 #include "API_IO.h"
+#include "API_eventQueue.h"
 
 /* === Cabecera C++ ============================================================================ */
 
@@ -49,38 +50,586 @@ extern "C" {
 /* === Public macros definitions =============================================================== */
 /**
  * @def TIEMPO_RETARDO
- * @brief Tiempo de retardo para anti-rebote en milisegundos
+ * @brief Tiempo de retardo para anti-rebote en milisegundos, se convierte con DELAY_MS()
  */
 #define TIEMPO_RETARDO 40
 
+/**
+ * @def GPIO_MAX_INSTANCES
+ * @brief Cantidad máxima de instancias que admite el registro de antirrebote
+ * @note Normalmente se define desde el makefile
+ */
+#ifndef GPIO_MAX_INSTANCES
+#define GPIO_MAX_INSTANCES 16
+#endif
+
+/**
+ * @def DEBOUNCE_ALGORITMO
+ * @brief Algoritmo que usa debounce_Init(), un valor de debounceAlgorithm_t
+ */
+#ifndef DEBOUNCE_ALGORITMO
+#define DEBOUNCE_ALGORITMO DEBOUNCE_ALG_TIMER
+#endif
+
+/**
+ * @def DEBOUNCE_INTEGRADOR_MAX
+ * @brief Muestras que satura el integrador: una entrada estable se confirma en esta cantidad de
+ * actualizaciones y cada muestra contraria retrasa la confirmación en dos
+ */
+#ifndef DEBOUNCE_INTEGRADOR_MAX
+#define DEBOUNCE_INTEGRADOR_MAX 8
+#endif
+
+/**
+ * @def DEBOUNCE_SHIFT_BITS
+ * @brief Muestras consecutivas iguales que confirma el registro de desplazamiento, hasta 16
+ */
+#ifndef DEBOUNCE_SHIFT_BITS
+#define DEBOUNCE_SHIFT_BITS 8
+#endif
+
+/**
+ * @def DEBOUNCE_ADAPT_MIN
+ * @brief Ventana mínima en ticks del algoritmo adaptativo, por defecto para cada instancia
+ */
+#ifndef DEBOUNCE_ADAPT_MIN
+#define DEBOUNCE_ADAPT_MIN DELAY_MS(5)
+#endif
+
+/**
+ * @def DEBOUNCE_ADAPT_MAX
+ * @brief Ventana máxima en ticks del algoritmo adaptativo, por defecto para cada instancia
+ */
+#ifndef DEBOUNCE_ADAPT_MAX
+#define DEBOUNCE_ADAPT_MAX DELAY_MS(100)
+#endif
+
+/**
+ * @def DEBOUNCE_ADAPT_MARGEN
+ * @brief Ticks que el algoritmo adaptativo agrega al rebote estimado para fijar la ventana
+ */
+#ifndef DEBOUNCE_ADAPT_MARGEN
+#define DEBOUNCE_ADAPT_MARGEN DELAY_MS(4)
+#endif
+
+/**
+ * @def DEBOUNCE_ADAPT_HISTERESIS
+ * @brief Diferencia en ticks que debe haber con la ventana calculada para achicar la actual
+ */
+#ifndef DEBOUNCE_ADAPT_HISTERESIS
+#define DEBOUNCE_ADAPT_HISTERESIS DELAY_MS(4)
+#endif
+
+/**
+ * @def DEBOUNCE_EAGER_MUESTRAS
+ * @brief Muestras consecutivas que confirman un flanco en el modo anticipado, 1 sin filtro de ruido
+ */
+#ifndef DEBOUNCE_EAGER_MUESTRAS
+#define DEBOUNCE_EAGER_MUESTRAS 1
+#endif
+
+/**
+ * @def DEBOUNCE_IO_INLINE
+ * @brief En 1 el antirrebote lee las entradas y escribe el LED con los accesos en línea de
+ * API_IO_inline.h, sin llamadas fuera de línea por instancia
+ * @note Desactivado en las pruebas, que reemplazan API_IO por un mock
+ */
+#ifndef DEBOUNCE_IO_INLINE
+#ifdef TEST
+#define DEBOUNCE_IO_INLINE 0
+#else
+#define DEBOUNCE_IO_INLINE 1
+#endif
+#endif
+
+/**
+ * @def DEBOUNCE_STATS
+ * @brief En 1 cada instancia registra latencias y antirrebotes abortados (ver debounceStats_t)
+ * @note Desactivado por defecto: agrega memoria a debounce_t y trabajo a cada transición
+ */
+#ifndef DEBOUNCE_STATS
+#define DEBOUNCE_STATS 0
+#endif
+
+/**
+ * @def DEBOUNCE_STATS_BINS
+ * @brief Cantidad de intervalos del histograma de latencias, el último acumula el desborde
+ */
+#ifndef DEBOUNCE_STATS_BINS
+#define DEBOUNCE_STATS_BINS 16
+#endif
+
+/**
+ * @def DEBOUNCE_STATS_BIN_TICKS
+ * @brief Ancho en ticks de cada intervalo del histograma de latencias
+ */
+#ifndef DEBOUNCE_STATS_BIN_TICKS
+#define DEBOUNCE_STATS_BIN_TICKS DELAY_MS(8)
+#endif
+
+/**
+ * @def DEBOUNCE_MAX_SUSCRIPTORES
+ * @brief Cantidad de instancias que pueden tener manejadores a la vez en la tabla de suscriptores
+ */
+#ifndef DEBOUNCE_MAX_SUSCRIPTORES
+#define DEBOUNCE_MAX_SUSCRIPTORES GPIO_MAX_INSTANCES
+#endif
+
+/**
+ * @def DEBOUNCE_LED_DEFAULT
+ * @brief En 1 debounceFSM_Init() apaga el LED de depuración y suscribe debounce_LedHandler() a
+ * la instancia por defecto, que lo enciende con cada presión y lo apaga con cada liberación
+ */
+#ifndef DEBOUNCE_LED_DEFAULT
+#define DEBOUNCE_LED_DEFAULT 1
+#endif
+
+/**
+ * @def DEBOUNCE_HANDLERS_HEADER
+ * @brief Cabecera opcional que enlaza los manejadores en tiempo de compilación
+ * @details Si se define, por ejemplo con DEBOUNCE_HANDLERS_HEADER='"app_handlers.h"', la
+ * cabecera debe definir DEBOUNCE_ON_PRESS(debounce, event) y DEBOUNCE_ON_RELEASE(debounce, event)
+ * como macros o funciones static inline. API_debounce.c las llama en lugar de consultar la tabla
+ * de suscriptores, así el compilador puede expandirlas en línea, y debounce_Subscribe() devuelve
+ * false. Con este modo la cabecera decide si llama a debounce_LedHandler()
+ */
+
+/**
+ * @def DEBOUNCE_WAIT_FOREVER
+ * @brief Timeout de debounce_WaitEvent() que espera sin límite
+ */
+#define DEBOUNCE_WAIT_FOREVER ((tick_t)~(tick_t)0)
+
+/**
+ * @def DEBOUNCE_WAIT_FUTEX
+ * @brief En 1 debounce_WaitEvent() bloquea el hilo con un futex de Linux; en 0 duerme el
+ * procesador con __WFI() hasta la próxima interrupción
+ * @note Por defecto 1 en el host (HAL_HOST o TEST sobre Linux) y 0 en la placa
+ */
+#ifndef DEBOUNCE_WAIT_FUTEX
+#if (defined(HAL_HOST) || defined(TEST)) && defined(__linux__)
+#define DEBOUNCE_WAIT_FUTEX 1
+#else
+#define DEBOUNCE_WAIT_FUTEX 0
+#endif
+#endif
+
 /* === Public data type declarations =========================================================== */
 
+/** @brief Estados internos de la FSM */
+typedef enum {
+    BUTTON_UP,
+    BUTTON_FALLING,
+    BUTTON_DOWN,
+    BUTTON_RISING,
+} debounceState_t;
+
+/**
+ * @enum debounceMode_t
+ * @brief Forma en que la FSM detecta el primer flanco de la entrada
+ */
+typedef enum {
+    DEBOUNCE_MODE_POLLING,   /**< Lee la entrada en cada actualización */
+    DEBOUNCE_MODE_INTERRUPT, /**< Solo lee la entrada luego de debounce_NotifyEdge() */
+} debounceMode_t;
+
+/**
+ * @enum debounceAlgorithm_t
+ * @brief Algoritmo de antirrebote de una instancia
+ * @details Solo DEBOUNCE_ALG_TIMER usa API_delay. Los otros cuentan actualizaciones: la latencia
+ * depende del período con que se llama a la actualización y no necesitan HAL_GetTick() si se usan
+ * las variantes *At con un contador propio.
+ */
+typedef enum {
+    DEBOUNCE_ALG_TIMER,      /**< FSM con retardo de TIEMPO_RETARDO ms */
+    DEBOUNCE_ALG_INTEGRATOR, /**< Contador saturado en 0 y DEBOUNCE_INTEGRADOR_MAX */
+    DEBOUNCE_ALG_SHIFT,      /**< DEBOUNCE_SHIFT_BITS muestras consecutivas iguales */
+    DEBOUNCE_ALG_ADAPTIVE,   /**< Ventana que se ajusta al rebote observado de la entrada */
+    DEBOUNCE_ALG_EAGER,      /**< Evento en el primer flanco y bloqueo por TIEMPO_RETARDO ms */
+    DEBOUNCE_ALG_COUNT,      /**< Cantidad de algoritmos, no es un algoritmo válido */
+} debounceAlgorithm_t;
+
+/**
+ * @struct debounceAdaptive_t
+ * @brief Estado del algoritmo adaptativo
+ * @details La entrada se confirma cuando pasa la ventana desde el primer flanco, igual que con
+ * DEBOUNCE_ALG_TIMER, pero mientras tanto se muestrea en cada actualización para medir cuánto
+ * rebota. La estimación sube de inmediato con un rebote más largo y baja de a un octavo de la
+ * diferencia con uno más corto. La ventana crece en cuanto la estimación más el margen la supera
+ * y solo se achica si queda DEBOUNCE_ADAPT_HISTERESIS ticks por debajo, así no oscila
+ */
+typedef struct {
+    tick_t inicio;       /**< Tick del primer flanco del antirrebote en curso */
+    tick_t ultimoCambio; /**< Tick del último cambio visto durante el antirrebote */
+    tick_t ventana;      /**< Ventana actual en ticks */
+    tick_t minimo;       /**< Menor ventana permitida */
+    tick_t maximo;       /**< Mayor ventana permitida */
+    uint32_t estimado;   /**< Rebote estimado en dieciseisavos de tick */
+    bool_t nivel;        /**< Última muestra leída durante el antirrebote */
+} debounceAdaptive_t;
+
+/**
+ * @struct debounceEager_t
+ * @brief Estado del algoritmo anticipado (leading-edge)
+ * @details El evento se informa en cuanto la entrada cambia durante las muestras configuradas.
+ * BUTTON_FALLING y BUTTON_RISING pasan a ser el bloqueo posterior al evento: la entrada no se lee
+ * hasta que vence el retardo, así los rebotes no generan eventos
+ */
+typedef struct {
+    delay_t bloqueo;       /**< Ventana en la que se ignora la entrada después de un evento */
+    uint8_t muestras;      /**< Muestras consecutivas que confirman un flanco */
+    uint8_t coincidencias; /**< Muestras consecutivas leídas distintas del estado estable */
+} debounceEager_t;
+
+/**
+ * @struct debounceStats_t
+ * @brief Estadísticas de una instancia para ajustar el antirrebote con datos de campo
+ * @details La latencia es el tiempo entre el primer flanco crudo que saca a la instancia de un
+ * estado estable y el evento confirmado. Los campos de latencia solo son válidos si eventos > 0
+ */
+typedef struct {
+    uint32_t eventos;                          /**< Presiones y liberaciones confirmadas */
+    uint32_t abortosPresion;                   /**< Transiciones BUTTON_FALLING a BUTTON_UP */
+    uint32_t abortosLiberacion;                /**< Transiciones BUTTON_RISING a BUTTON_DOWN */
+    tick_t primerFlanco;                       /**< Tick del primer flanco del último antirrebote */
+    tick_t ultimoEvento;                       /**< Tick del último evento confirmado */
+    tick_t latenciaMinima;                     /**< Menor latencia observada */
+    tick_t latenciaMaxima;                     /**< Mayor latencia observada */
+    uint32_t histograma[DEBOUNCE_STATS_BINS];  /**< Eventos por intervalo de latencia */
+} debounceStats_t;
+
+/**
+ * @brief Manejador de un evento confirmado por una instancia
+ * @param event Evento con el dispositivo, el flanco y el tick en que se confirmó
+ * @param contexto Puntero registrado junto con el manejador en debounce_Subscribe()
+ * @note Se llama desde la actualización de la instancia, en su mismo contexto de ejecución
+ */
+typedef void (*debounceHandler_t)(const event_t * event, void * contexto);
+
+/**
+ * @struct debounce_t
+ * @brief Instancia de la FSM de antirrebote asociada a un dispositivo de entrada
+ */
+typedef struct {
+    IO_Device_t device;     /**< Dispositivo de entrada que se muestrea */
+    debounceState_t estado; /**< Estado actual de la FSM */
+    uint8_t algoritmo;      /**< Algoritmo de antirrebote, un valor de debounceAlgorithm_t */
+    union {
+        delay_t retardo;    /**< Temporizador para antirrebote, DEBOUNCE_ALG_TIMER */
+        uint8_t integrador; /**< Muestras activas acumuladas, DEBOUNCE_ALG_INTEGRATOR */
+        uint16_t historia;  /**< Últimas muestras, la más reciente en el bit 0, DEBOUNCE_ALG_SHIFT */
+        debounceAdaptive_t adaptativo; /**< Ventana aprendida, DEBOUNCE_ALG_ADAPTIVE */
+        debounceEager_t anticipado;    /**< Bloqueo y filtro de ruido, DEBOUNCE_ALG_EAGER */
+    };
+    bool_t keyDesc;         /**< Flag de evento de presión */
+    bool_t keyAsc;          /**< Flag de evento de liberación */
+    debounceMode_t modo;    /**< Forma de detectar el primer flanco */
+    atomic_bool flanco;     /**< Flanco notificado por interrupción y aún no procesado */
+    uint8_t suscriptor;     /**< Posición más uno en la tabla de suscriptores, 0 sin manejadores */
+#if DEBOUNCE_STATS
+    debounceStats_t stats; /**< Estadísticas de latencia y rebotes */
+#endif
+} debounce_t;
+
 /* === Public variable declarations ============================================================ */
 
 /* === Public function declarations ============================================================ */
 
+/**
+ * @brief Inicializa una instancia de la FSM de antirrebote
+ * @param debounce Puntero a la instancia a inicializar
+ * @param device Dispositivo de entrada que debe muestrear la instancia
+ */
+void debounce_Init(debounce_t * debounce, IO_Device_t device);
+
+/**
+ * @brief Inicializa una instancia con un algoritmo de antirrebote determinado
+ * @param debounce Puntero a la instancia a inicializar
+ * @param device Dispositivo de entrada que debe muestrear la instancia
+ * @param algoritmo Algoritmo que usa la instancia
+ * @return false si el algoritmo no existe; la instancia queda sin inicializar
+ * @note debounce_Init() equivale a usar DEBOUNCE_ALGORITMO. Ambas quitan los manejadores que
+ *       tuviera la instancia
+ */
+bool_t debounce_InitWith(debounce_t * debounce, IO_Device_t device,
+                         debounceAlgorithm_t algoritmo);
+
+/**
+ * @brief Fija los límites de la ventana de una instancia con el algoritmo adaptativo
+ * @param debounce Instancia a configurar
+ * @param minimo Menor ventana en ticks, mayor que cero
+ * @param maximo Mayor ventana en ticks
+ * @return false si la instancia no es adaptativa o los límites no son válidos
+ * @note La ventana actual se ajusta a los nuevos límites
+ */
+bool_t debounce_SetAdaptiveBounds(debounce_t * debounce, tick_t minimo, tick_t maximo);
+
+/**
+ * @brief Fija cuántas muestras consecutivas confirman un flanco en el modo anticipado
+ * @param debounce Instancia a configurar
+ * @param muestras Muestras iguales necesarias, 1 informa el primer cambio leído
+ * @return false si la instancia no usa DEBOUNCE_ALG_EAGER o muestras es cero
+ * @note Cada muestra extra agrega una actualización de latencia y descarta picos de ruido más
+ *       cortos que el período de actualización
+ */
+bool_t debounce_SetEagerSamples(debounce_t * debounce, uint8_t muestras);
+
+/**
+ * @brief Ventana de antirrebote vigente de una instancia
+ * @param debounce Instancia a consultar
+ * @return Ventana o bloqueo en ticks con DEBOUNCE_ALG_TIMER, DEBOUNCE_ALG_ADAPTIVE o
+ *         DEBOUNCE_ALG_EAGER, 0 con los algoritmos que cuentan actualizaciones
+ */
+tick_t debounce_GetWindow(const debounce_t * debounce);
+
+/**
+ * @brief Bytes de estado propio que usa un algoritmo dentro de debounce_t
+ * @param algoritmo Algoritmo a consultar
+ * @return Tamaño del estado del algoritmo, 0 si no existe
+ */
+uint8_t debounce_AlgorithmStateSize(debounceAlgorithm_t algoritmo);
+
+/**
+ * @brief Actualiza el estado de una instancia de la FSM
+ * @param debounce Puntero a la instancia a actualizar
+ * @details Debe ser llamado periódicamente en el main loop
+ */
+void debounce_Update(debounce_t * debounce);
+
+/**
+ * @brief Actualiza el estado de una instancia de la FSM en un instante dado
+ * @param debounce Puntero a la instancia a actualizar
+ * @param now Tick actual, leído una sola vez por iteración del main loop
+ */
+void debounce_UpdateAt(debounce_t * debounce, tick_t now);
+
+/**
+ * @brief Actualiza una instancia usando una lectura previa de todas las entradas
+ * @param debounce Puntero a la instancia a actualizar
+ * @param snapshot Estado de los dispositivos obtenido con IO_ReadMany()
+ * @note Evita una llamada a IO_Read() por instancia cuando se actualizan muchas entradas
+ */
+void debounce_UpdateSnapshot(debounce_t * debounce, IO_Snapshot_t snapshot);
+
+/**
+ * @brief Actualiza una instancia usando una lectura previa de todas las entradas y un tick dado
+ * @param debounce Puntero a la instancia a actualizar
+ * @param snapshot Estado de los dispositivos obtenido con IO_ReadMany()
+ * @param now Tick actual
+ */
+void debounce_UpdateSnapshotAt(debounce_t * debounce, IO_Snapshot_t snapshot, tick_t now);
+
+/**
+ * @brief Verifica si la instancia detectó un flanco descendente
+ * @param debounce Puntero a la instancia a consultar
+ * @return true si se detectó flanco descendente (botón presionado)
+ * @note Resetea automáticamente el estado después de leer
+ */
+bool_t debounce_ReadPressed(debounce_t * debounce);
+
+/**
+ * @brief Verifica si la instancia detectó un flanco ascendente
+ * @param debounce Puntero a la instancia a consultar
+ * @return true si se detectó flanco ascendente (botón liberado)
+ * @note Resetea automáticamente el estado después de leer
+ */
+bool_t debounce_ReadReleased(debounce_t * debounce);
+
+/**
+ * @brief Selecciona la forma en que la instancia detecta el primer flanco
+ * @param debounce Puntero a la instancia
+ * @param modo DEBOUNCE_MODE_POLLING o DEBOUNCE_MODE_INTERRUPT
+ * @details En DEBOUNCE_MODE_INTERRUPT la FSM no lee la entrada en BUTTON_UP ni en BUTTON_DOWN
+ * hasta que la interrupción de cambio de pin llama a debounce_NotifyEdge(). La entrada se
+ * muestrea una vez al cambiar de modo para no perder un estado previo.
+ */
+void debounce_SetMode(debounce_t * debounce, debounceMode_t modo);
+
+/**
+ * @brief Notifica un cambio en el pin de la instancia
+ * @param debounce Puntero a la instancia
+ * @note Se puede llamar desde la rutina de interrupción de cambio de pin
+ */
+void debounce_NotifyEdge(debounce_t * debounce);
+
+/**
+ * @brief Notifica un cambio en el pin de un dispositivo a todas sus instancias
+ * @param device Dispositivo cuyo pin cambió
+ * @note Recorre la instancia por defecto y las registradas. Se puede llamar desde la rutina
+ * de interrupción de cambio de pin (por ejemplo HAL_GPIO_EXTI_Callback)
+ */
+void debounce_NotifyDevice(IO_Device_t device);
+
+/**
+ * @brief Indica si la instancia necesita seguir siendo actualizada
+ * @param debounce Puntero a la instancia
+ * @return true si está en modo polling, tiene un antirrebote en curso o un flanco sin procesar
+ */
+bool_t debounce_IsActive(debounce_t * debounce);
+
+/**
+ * @brief Indica si alguna instancia necesita ser actualizada
+ * @return true si la instancia por defecto o alguna registrada está activa
+ * @details Cuando devuelve false el main loop puede dormir hasta la próxima interrupción
+ */
+bool_t debounce_AnyActive(void);
+
+/**
+ * @brief Extrae el evento más antiguo confirmado por cualquier instancia
+ * @param event Puntero donde se copia el evento (dispositivo, flanco y tick de confirmación)
+ * @return true si había un evento pendiente
+ * @details A diferencia de debounce_ReadPressed() y debounce_ReadReleased() conserva el orden
+ * entre presiones y liberaciones y no pierde eventos si el consumidor es más lento que el usuario
+ * @note Todas las actualizaciones de instancias deben hacerse desde un mismo contexto (productor)
+ */
+bool_t debounce_ReadEvent(event_t * event);
+
+/**
+ * @brief Obtiene los contadores de uso de la cola de eventos
+ * @param stats Puntero donde se copian los contadores
+ */
+void debounce_EventStats(eventQueueStats_t * stats);
+
+/**
+ * @brief Copia las estadísticas de una instancia
+ * @param debounce Instancia a consultar
+ * @param stats Puntero donde se copian las estadísticas
+ * @return false si las estadísticas están desactivadas (DEBOUNCE_STATS en 0); stats queda en cero
+ * @note Llamar desde el mismo contexto que actualiza la instancia para obtener una copia coherente
+ */
+bool_t debounce_GetStats(const debounce_t * debounce, debounceStats_t * stats);
+
+/**
+ * @brief Pone en cero las estadísticas de una instancia
+ * @param debounce Instancia a modificar
+ */
+void debounce_ResetStats(debounce_t * debounce);
+
+/**
+ * @brief Bloquea hasta que alguna de las entradas indicadas confirme un evento o venza el timeout
+ * @details Cada evento confirmado marca su dispositivo como avisado después de encolarlo y de
+ * activar las banderas de la instancia, así al volver ya se puede leer con debounce_ReadEvent()
+ * o debounce_ReadPressed(). La función devuelve y borra los avisos de las entradas pedidas: un
+ * evento confirmado antes de la llamada y todavía no informado despierta enseguida. En el host
+ * el hilo duerme en un futex; en la placa el procesador duerme con __WFI() y el antirrebote debe
+ * actualizarse desde una interrupción (por ejemplo el SysTick)
+ * @param timeout Ticks máximos de espera, 0 solo consulta, DEBOUNCE_WAIT_FOREVER sin límite
+ * @param entradas Máscara de dispositivos que despiertan la espera, armada con IO_MASK()
+ * @return Entradas de la máscara con eventos nuevos, 0 si venció el timeout
+ * @note Si varios hilos esperan la misma entrada, solo uno recibe cada aviso
+ */
+IO_Snapshot_t debounce_WaitEvent(tick_t timeout, IO_Snapshot_t entradas);
+
+/**
+ * @brief Suscribe manejadores a los eventos que confirma una instancia
+ * @details Los manejadores se guardan en una tabla estática de DEBOUNCE_MAX_SUSCRIPTORES entradas
+ * y la instancia recuerda su posición, así cada evento se entrega con un acceso directo, en la
+ * misma actualización que lo confirma y después de encolarlo. Suscribir de nuevo una instancia
+ * reemplaza sus manejadores
+ * @param debounce Instancia ya inicializada
+ * @param onPress Manejador de las presiones, o NULL para ignorarlas
+ * @param onRelease Manejador de las liberaciones, o NULL para ignorarlas
+ * @param contexto Puntero que se entrega a ambos manejadores
+ * @return false si la tabla está llena o los manejadores se enlazan en tiempo de compilación
+ *         (ver DEBOUNCE_HANDLERS_HEADER)
+ */
+bool_t debounce_Subscribe(debounce_t * debounce, debounceHandler_t onPress,
+                          debounceHandler_t onRelease, void * contexto);
+
+/**
+ * @brief Quita los manejadores de una instancia y libera su entrada de la tabla
+ * @param debounce Instancia a modificar
+ */
+void debounce_Unsubscribe(debounce_t * debounce);
+
+/**
+ * @brief Manejador que refleja el evento en el LED de depuración
+ * @details Enciende el LED con EVENT_PRESSED y lo apaga con EVENT_RELEASED. Es el suscriptor por
+ * defecto de la FSM por defecto cuando DEBOUNCE_LED_DEFAULT vale 1
+ * @param event Evento confirmado
+ * @param contexto No se usa
+ */
+void debounce_LedHandler(const event_t * event, void * contexto);
+
+/**
+ * @brief Agrega una instancia al registro que actualiza debounce_UpdateAll()
+ * @param debounce Puntero a la instancia ya inicializada
+ * @return true si se registró, false si el puntero es NULL, ya estaba registrada o se alcanzó
+ *         GPIO_MAX_INSTANCES
+ */
+bool_t debounce_Register(debounce_t * debounce);
+
+/**
+ * @brief Actualiza todas las instancias registradas
+ * @details Reemplaza a un llamado de debounce_Update() por instancia en el main loop. Las entradas
+ * se leen una sola vez con IO_ReadMany(), por lo que requiere haber llamado a IO_Init()
+ */
+void debounce_UpdateAll(void);
+
+/**
+ * @brief Actualiza todas las instancias registradas en un instante dado
+ * @param now Tick actual, compartido por todas las instancias
+ */
+void debounce_UpdateAllAt(tick_t now);
+
 /**
  * @brief Inicializa la FSM de antirrebote
+ * @note Opera sobre la instancia por defecto asociada a IO_BUTTON_USER
  */
 void debounceFSM_Init(void);
 
+/**
+ * @brief Inicializa la FSM de antirrebote por defecto con un algoritmo determinado
+ * @param algoritmo Algoritmo de la instancia asociada a IO_BUTTON_USER
+ * @return false si el algoritmo no existe
+ * @note Igual que debounceFSM_Init() vuelve a suscribir el LED de depuración si
+ *       DEBOUNCE_LED_DEFAULT vale 1
+ */
+bool_t debounceFSM_InitWith(debounceAlgorithm_t algoritmo);
+
+/**
+ * @brief Fija las muestras que confirman un flanco si la FSM por defecto usa el modo anticipado
+ * @param muestras Muestras iguales necesarias
+ * @return false si la FSM por defecto no usa DEBOUNCE_ALG_EAGER o muestras es cero
+ */
+bool_t debounceFSM_SetEagerSamples(uint8_t muestras);
+
+/**
+ * @brief Selecciona la forma en que la FSM por defecto detecta el primer flanco
+ * @param modo DEBOUNCE_MODE_POLLING o DEBOUNCE_MODE_INTERRUPT
+ */
+void debounceFSM_SetMode(debounceMode_t modo);
+
 /**
  * @brief Actualiza el estado de la FSM
- * @details Debe ser llamado periódicamente en el main loop
+ * @details Debe ser llamado periódicamente en el main loop, por ejemplo desde una tarea periódica
+ * de API_scheduler que fije el período de muestreo y mida su atraso
  */
 void debounceFSM_Update(void);
 
 /**
- * @brief Maneja el evento de botón presionado
- * @note Activa la bandera de flanco descendente y enciende el LED de depuración
+ * @brief Actualiza el estado de la FSM en un instante dado
+ * @param now Tick actual
+ */
+void debounceFSM_UpdateAt(tick_t now);
+
+/**
+ * @brief Copia las estadísticas de la instancia por defecto
+ * @param stats Puntero donde se copian las estadísticas
+ * @return false si las estadísticas están desactivadas
  */
-void button_Pressed();
+bool_t debounceFSM_GetStats(debounceStats_t * stats);
 
 /**
- * @brief Maneja el evento de botón liberado
- * @note Activa la bandera de flanco ascendente y apaga el LED de depuración
+ * @brief Reemplaza los manejadores de la instancia por defecto, incluido el LED de depuración
+ * @param onPress Manejador de las presiones, o NULL para ignorarlas
+ * @param onRelease Manejador de las liberaciones, o NULL para ignorarlas
+ * @param contexto Puntero que se entrega a ambos manejadores
+ * @return false si no se pudo suscribir (ver debounce_Subscribe())
+ * @note Llamar después de debounceFSM_Init(), que vuelve a suscribir el LED
  */
-void button_Released();
+bool_t debounceFSM_Subscribe(debounceHandler_t onPress, debounceHandler_t onRelease,
+                             void * contexto);
 
 /**
  * @brief Verifica si hubo flanco descendente
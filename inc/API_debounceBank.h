@@ -0,0 +1,170 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+#ifndef API_INC_API_DEBOUNCEBANK_H_
+#define API_INC_API_DEBOUNCEBANK_H_
+
+/**
+ * @file API_debounceBank.h
+ * @brief Antirrebote temporizado para miles de entradas guardado como estructura de arreglos
+ * @details Pensado para cadenas de registros de desplazamiento y expansores de IO, donde una
+ * debounce_t por entrada desperdicia memoria y caché. El estado de cada entrada ocupa 2 bits,
+ * repartidos en dos planos de bits igual que en API_vcounter:
+ * | nivel | contando | Estado FSM     |
+ * |-------|----------|----------------|
+ * | 0     | 0        | BUTTON_UP      |
+ * | 0     | 1        | BUTTON_FALLING |
+ * | 1     | 0        | BUTTON_DOWN    |
+ * | 1     | 1        | BUTTON_RISING  |
+ *
+ * Los vencimientos son un arreglo denso de tick_t y los flancos confirmados se acumulan en dos
+ * planos más. Igual que DEBOUNCE_ALG_TIMER, una entrada que cambia arranca el retardo y al vencer
+ * se confirma el cambio si la muestra sigue distinta del nivel estable, o se descarta si volvió.
+ * La actualización compara cada palabra de la muestra con el plano de nivel y solo visita una a
+ * una las entradas del plano contando.
+ *
+ * La memoria la provee quien llama, con los tamaños de DEBOUNCE_BANK_BITS() y
+ * DEBOUNCE_BANK_DEFINE().
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions ================================================================ */
+#ifndef __STDINT_H_
+#include <stdint.h>
+#endif
+
+#include "API_debounce.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+/** @brief Cantidad de entradas por palabra de los planos de bits */
+#define DEBOUNCE_BANK_WIDTH 32u
+
+/**
+ * @def DEBOUNCE_BANK_WORDS
+ * @brief Palabras de un plano de bits para la cantidad de entradas indicada
+ */
+#define DEBOUNCE_BANK_WORDS(entradas)                                                              \
+    (((entradas) + DEBOUNCE_BANK_WIDTH - 1u) / DEBOUNCE_BANK_WIDTH)
+
+/**
+ * @def DEBOUNCE_BANK_BITS
+ * @brief Palabras de debounceBank_word_t para los cuatro planos de la cantidad de entradas
+ */
+#define DEBOUNCE_BANK_BITS(entradas) (4u * DEBOUNCE_BANK_WORDS(entradas))
+
+/**
+ * @def DEBOUNCE_BANK_DEFINE
+ * @brief Declara la memoria estática de un banco: nombre_bits y nombre_vencimientos
+ */
+#define DEBOUNCE_BANK_DEFINE(nombre, entradas)                                                     \
+    static debounceBank_word_t nombre##_bits[DEBOUNCE_BANK_BITS(entradas)];                        \
+    static tick_t nombre##_vencimientos[(entradas)]
+
+/* === Public data type declarations =========================================================== */
+/** @brief Palabra de un plano de bits, una entrada por bit */
+typedef uint32_t debounceBank_word_t;
+
+/**
+ * @struct debounceBank_t
+ * @brief Estado de antirrebote de un grupo de entradas
+ */
+typedef struct {
+    uint32_t cantidad;                 /**< Entradas del banco */
+    uint32_t palabras;                 /**< Palabras de cada plano */
+    tick_t duracion;                   /**< Retardo de antirrebote en ticks */
+    debounceBank_word_t * nivel;       /**< Estado estable de cada entrada (1 = presionada) */
+    debounceBank_word_t * contando;    /**< Entradas con el retardo en curso */
+    debounceBank_word_t * presionadas; /**< Presiones confirmadas sin leer */
+    debounceBank_word_t * liberadas;   /**< Liberaciones confirmadas sin leer */
+    tick_t * vencimientos;             /**< Vencimiento del retardo, válido si contando */
+} debounceBank_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+/**
+ * @brief Inicializa un banco con todas las entradas en BUTTON_UP
+ * @param bank Banco a inicializar
+ * @param cantidad Cantidad de entradas
+ * @param bits Memoria para los planos, de DEBOUNCE_BANK_BITS(cantidad) palabras
+ * @param vencimientos Memoria para los vencimientos, de cantidad elementos
+ * @param duracion Retardo de antirrebote en ticks, por ejemplo DELAY_MS(TIEMPO_RETARDO)
+ * @return true si se inicializó, false si falta memoria o cantidad es 0
+ */
+bool_t debounceBank_Init(debounceBank_t * bank, uint32_t cantidad, debounceBank_word_t * bits,
+                         tick_t * vencimientos, tick_t duracion);
+
+/**
+ * @brief Procesa una muestra de todas las entradas
+ * @param bank Banco a actualizar
+ * @param muestra Lectura cruda, DEBOUNCE_BANK_WORDS(cantidad) palabras con una entrada por bit
+ * @param now Tick actual
+ * @return Cantidad de flancos confirmados en esta actualización
+ */
+uint32_t debounceBank_Update(debounceBank_t * bank, const debounceBank_word_t * muestra,
+                             tick_t now);
+
+/**
+ * @brief Entrega y borra los flancos confirmados de una palabra de entradas
+ * @param bank Banco a consultar
+ * @param palabra Índice de la palabra, entradas 32 * palabra en adelante
+ * @param pressed Puntero donde se almacenan las presiones confirmadas
+ * @param released Puntero donde se almacenan las liberaciones confirmadas
+ * @return true si había al menos un flanco
+ */
+bool_t debounceBank_TakeEdges(debounceBank_t * bank, uint32_t palabra,
+                              debounceBank_word_t * pressed, debounceBank_word_t * released);
+
+/**
+ * @brief Lee y borra la presión confirmada de una entrada
+ * @return true si la entrada se presionó desde la última lectura
+ */
+bool_t debounceBank_ReadPressed(debounceBank_t * bank, uint32_t entrada);
+
+/**
+ * @brief Lee y borra la liberación confirmada de una entrada
+ * @return true si la entrada se liberó desde la última lectura
+ */
+bool_t debounceBank_ReadReleased(debounceBank_t * bank, uint32_t entrada);
+
+/**
+ * @brief Traduce el estado de una entrada a los estados de la FSM de API_debounce
+ * @return Estado equivalente de la FSM, BUTTON_UP si la entrada no existe
+ */
+debounceState_t debounceBank_State(const debounceBank_t * bank, uint32_t entrada);
+
+/**
+ * @brief Memoria que ocupa un banco de la cantidad de entradas indicada
+ * @return Bytes de planos, vencimientos y debounceBank_t
+ */
+uint32_t debounceBank_Footprint(uint32_t cantidad);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* API_INC_API_DEBOUNCEBANK_H_ */
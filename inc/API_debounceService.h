@@ -0,0 +1,240 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+#ifndef API_INC_API_DEBOUNCESERVICE_H_
+#define API_INC_API_DEBOUNCESERVICE_H_
+
+/**
+ * @file API_debounceService.h
+ * @brief Servicio de antirrebote multihilo para cientos de miles de entradas virtuales en el host
+ * @details Pensado para pasarelas que reciben los cambios de puntos de IO remotos. Las entradas se
+ * reparten en rangos contiguos (shards), cada uno con su propio API_debounceBank, su muestra
+ * cruda y una cola acotada sin bloqueos. Los shards se alinean a la línea de caché y los
+ * contadores que escriben los productores quedan en otra línea que los que escribe el hilo que
+ * procesa el shard.
+ *
+ * Cada hilo trabajador atiende los shards i, i + hilos, i + 2 * hilos, ... y cuando esos no
+ * tienen muestras roba shards ajenos cuya cola supera DEBOUNCE_SERVICE_ROBO. El estado de un
+ * shard lo modifica un solo hilo a la vez: quien lo procesa lo toma con una bandera atómica, así
+ * el robo trabaja por shard completo y no hace falta sincronizar el banco.
+ *
+ * Con hilos = 0 no se crean hilos y la aplicación procesa todos los shards llamando a
+ * debounceService_Poll(). Solo compila en el host (HAL_HOST o TEST) porque usa POSIX threads.
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions ================================================================ */
+#ifndef __STDINT_H_
+#include <stdint.h>
+#endif
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "API_debounceBank.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+/**
+ * @def DEBOUNCE_SERVICE_COLA
+ * @brief Muestras que admite la cola de cada shard, potencia de 2
+ */
+#ifndef DEBOUNCE_SERVICE_COLA
+#define DEBOUNCE_SERVICE_COLA 4096u
+#endif
+
+/**
+ * @def DEBOUNCE_SERVICE_SHARDS_POR_HILO
+ * @brief Shards que se crean por hilo trabajador, más de uno permite repartir los shards cargados
+ */
+#ifndef DEBOUNCE_SERVICE_SHARDS_POR_HILO
+#define DEBOUNCE_SERVICE_SHARDS_POR_HILO 4u
+#endif
+
+/**
+ * @def DEBOUNCE_SERVICE_LOTE
+ * @brief Muestras que se sacan de la cola de un shard antes de pasar al siguiente
+ */
+#ifndef DEBOUNCE_SERVICE_LOTE
+#define DEBOUNCE_SERVICE_LOTE 256u
+#endif
+
+/**
+ * @def DEBOUNCE_SERVICE_ROBO
+ * @brief Muestras pendientes a partir de las cuales un hilo sin trabajo toma un shard ajeno
+ */
+#ifndef DEBOUNCE_SERVICE_ROBO
+#define DEBOUNCE_SERVICE_ROBO 32u
+#endif
+
+/**
+ * @def DEBOUNCE_SERVICE_SIESTA_NS
+ * @brief Espera de un hilo que no encontró trabajo en DEBOUNCE_SERVICE_GIROS vueltas seguidas
+ */
+#ifndef DEBOUNCE_SERVICE_SIESTA_NS
+#define DEBOUNCE_SERVICE_SIESTA_NS 50000l
+#endif
+
+/**
+ * @def DEBOUNCE_SERVICE_GIROS
+ * @brief Vueltas sin trabajo en las que un hilo solo cede el procesador antes de dormir
+ */
+#ifndef DEBOUNCE_SERVICE_GIROS
+#define DEBOUNCE_SERVICE_GIROS 64u
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @struct debounceServiceEvent_t
+ * @brief Flanco confirmado de una entrada del servicio
+ */
+typedef struct {
+    uint32_t entrada; /**< Índice de la entrada, de 0 a entradas - 1 */
+    uint8_t edge;     /**< EVENT_PRESSED o EVENT_RELEASED */
+    tick_t tick;      /**< Tick en el que se confirmó */
+} debounceServiceEvent_t;
+
+/**
+ * @brief Manejador de los flancos confirmados
+ * @param event Flanco confirmado
+ * @param contexto Puntero de debounceServiceConfig_t
+ * @note Lo llaman los hilos trabajadores en paralelo: debe ser seguro entre hilos. Los eventos de
+ *       una misma entrada llegan siempre en orden
+ */
+typedef void (*debounceServiceHandler_t)(const debounceServiceEvent_t * event, void * contexto);
+
+/**
+ * @struct debounceServiceConfig_t
+ * @brief Parámetros del servicio
+ */
+typedef struct {
+    uint32_t entradas;                /**< Cantidad de entradas virtuales */
+    uint8_t hilos;                    /**< Hilos trabajadores, 0 para procesar con Poll() */
+    tick_t duracion;                  /**< Retardo de antirrebote en ticks */
+    debounceServiceHandler_t handler; /**< Destino de los flancos confirmados, puede ser NULL */
+    void * contexto;                  /**< Puntero que se entrega al manejador */
+} debounceServiceConfig_t;
+
+/**
+ * @struct debounceServiceStats_t
+ * @brief Contadores acumulados de todos los shards
+ */
+typedef struct {
+    uint64_t muestras;    /**< Muestras aplicadas a los bancos */
+    uint64_t robadas;     /**< Muestras aplicadas por un hilo distinto del dueño del shard */
+    uint64_t descartadas; /**< Muestras rechazadas por cola llena */
+    uint64_t eventos;     /**< Flancos confirmados entregados */
+} debounceServiceStats_t;
+
+/** @brief Shard del servicio, definido en API_debounceService.c */
+typedef struct debounceShard_s debounceShard_t;
+
+/** @brief Parámetros de cada hilo trabajador, definido en API_debounceService.c */
+typedef struct debounceWorker_s debounceWorker_t;
+
+/**
+ * @struct debounceService_t
+ * @brief Estado del servicio
+ */
+typedef struct {
+    debounceServiceConfig_t config;  /**< Copia de la configuración */
+    debounceShard_t * shards;        /**< Shards alineados a la línea de caché */
+    uint32_t cantidadShards;         /**< Shards creados */
+    uint32_t entradasPorShard;       /**< Entradas de cada shard, múltiplo de DEBOUNCE_BANK_WIDTH */
+    debounceWorker_t * trabajadores; /**< Un elemento por hilo */
+    uint8_t hilosActivos;            /**< Hilos lanzados por debounceService_Start() */
+    atomic_bool corriendo;           /**< Los hilos siguen procesando mientras valga true */
+} debounceService_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Reserva los shards e inicializa sus bancos con todas las entradas en BUTTON_UP
+ * @param service Servicio a inicializar
+ * @param config Parámetros, se copian
+ * @return false si entradas es 0 o no hay memoria
+ * @note Es la única parte de la biblioteca que usa memoria dinámica; se libera con
+ *       debounceService_Destroy()
+ */
+bool_t debounceService_Init(debounceService_t * service, const debounceServiceConfig_t * config);
+
+/**
+ * @brief Lanza los hilos trabajadores
+ * @param service Servicio inicializado
+ * @return false si config.hilos es 0 o no se pudieron crear los hilos
+ */
+bool_t debounceService_Start(debounceService_t * service);
+
+/**
+ * @brief Encola una muestra cruda de una entrada en la cola de su shard
+ * @details No bloquea y se puede llamar desde varios hilos productores a la vez. El orden entre
+ * muestras de una misma entrada solo se conserva si las encola un mismo hilo
+ * @param service Servicio
+ * @param entrada Índice de la entrada
+ * @param nivel Nivel leído, true = presionada
+ * @return false si la entrada no existe o la cola del shard está llena
+ */
+bool_t debounceService_Push(debounceService_t * service, uint32_t entrada, bool_t nivel);
+
+/**
+ * @brief Procesa todos los shards desde el hilo que llama
+ * @details Es el lazo de los hilos trabajadores reducido a una vuelta; con hilos = 0 la
+ * aplicación lo llama periódicamente. También avanza los retardos aunque no haya muestras
+ * @param service Servicio
+ * @param now Tick actual
+ * @return Muestras aplicadas
+ */
+uint32_t debounceService_Poll(debounceService_t * service, tick_t now);
+
+/**
+ * @brief Detiene los hilos trabajadores y espera que terminen
+ * @param service Servicio
+ * @note Las muestras que quedaron en las colas se procesan con el próximo Start() o Poll()
+ */
+void debounceService_Stop(debounceService_t * service);
+
+/**
+ * @brief Detiene los hilos si siguen corriendo y libera la memoria del servicio
+ * @param service Servicio
+ */
+void debounceService_Destroy(debounceService_t * service);
+
+/**
+ * @brief Suma los contadores de todos los shards
+ * @param service Servicio
+ * @param stats Puntero donde se copian los contadores
+ * @note Los contadores se leen mientras los hilos trabajan, cada uno es coherente por separado
+ */
+void debounceService_GetStats(const debounceService_t * service, debounceServiceStats_t * stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* API_INC_API_DEBOUNCESERVICE_H_ */
@@ -45,11 +45,49 @@ extern "C" {
 #endif
 
 /* === Public macros definitions =============================================================== */
+/**
+ * @def DELAY_SERVICE_SIZE
+ * @brief Cantidad máxima de retardos registrados a la vez en el servicio de temporizadores
+ */
+#ifndef DELAY_SERVICE_SIZE
+#define DELAY_SERVICE_SIZE 256
+#endif
+
+/**
+ * @def DELAY_TICK_HZ
+ * @brief Frecuencia de la base de tiempo: 1000 cuenta milisegundos, 1000000 microsegundos
+ * @note Con otra frecuencia que 1000 hay que indicar la fuente con DELAY_CLOCK o delay_SetClock()
+ */
+#ifndef DELAY_TICK_HZ
+#define DELAY_TICK_HZ 1000u
+#endif
+
+/** @brief Convierte milisegundos a ticks de la base de tiempo */
+#define DELAY_MS(ms) ((tick_t)((uint64_t)(ms) * (DELAY_TICK_HZ) / 1000u))
+
+/** @brief Convierte microsegundos a ticks de la base de tiempo */
+#define DELAY_US(us) ((tick_t)((uint64_t)(us) * (DELAY_TICK_HZ) / 1000000u))
+
+/**
+ * @def DELAY_MIN
+ * @brief Duración mínima en ticks de un retardo, las menores se ajustan a este valor
+ */
+#ifndef DELAY_MIN
+#define DELAY_MIN DELAY_MS(50)
+#endif
+
+/**
+ * @def DELAY_MAX
+ * @brief Duración máxima en ticks de un retardo, menor que medio rango de tick_t
+ */
+#ifndef DELAY_MAX
+#define DELAY_MAX DELAY_MS(2000)
+#endif
 
 /* === Public data type declarations =========================================================== */
 /**
  * @typedef tick_t
- * @brief Tipo de dato para el manejo de ticks (milisegundos)
+ * @brief Tipo de dato para el manejo de ticks (períodos de 1 / DELAY_TICK_HZ segundos)
  */
 typedef uint32_t tick_t;
 
@@ -60,14 +98,35 @@ typedef uint32_t tick_t;
 typedef bool bool_t;
 
 /**
- * @struct delay_t
+ * @typedef delayClock_t
+ * @brief Fuente de reloj: devuelve el tick actual y desborda naturalmente a 32 bits
+ */
+typedef tick_t (*delayClock_t)(void);
+
+/**
+ * @typedef delay_t
  * @brief Estructura para el manejo de retardos
  */
-typedef struct {
+typedef struct delay_s delay_t;
+
+/**
+ * @typedef delayCallback_t
+ * @brief Función llamada por el servicio de temporizadores cuando vence un retardo
+ */
+typedef void (*delayCallback_t)(delay_t * delay);
+
+/**
+ * @struct delay_s
+ * @brief Estructura para el manejo de retardos
+ */
+struct delay_s {
     tick_t startTime;
     tick_t duration;
     bool_t running;
-} delay_t;
+    bool_t postergado;        /**< Un callback lo volvió a iniciar ya vencido en delayProcess() */
+    uint16_t slot;            /**< Posición en el servicio de temporizadores + 1, 0 si no está */
+    delayCallback_t callback; /**< Función a llamar al vencer dentro del servicio */
+};
 
 /* === Public variable declarations ============================================================ */
 
@@ -75,8 +134,9 @@ typedef struct {
 /**
  * @brief Inicializa una estructura de retardo
  * @param delay Puntero a la estructura delay_t a inicializar
- * @param duration Duración del retardo en milisegundos
- * @note La estructura se inicializa en estado "no running"
+ * @param duration Duración del retardo en ticks, ajustada entre DELAY_MIN y DELAY_MAX
+ * @note La estructura se inicializa en estado "no running". No se debe usar sobre un retardo
+ * que está en el servicio de temporizadores (ver delayStop())
  */
 void delayInit(delay_t * delay, tick_t duration);
 
@@ -88,13 +148,94 @@ void delayInit(delay_t * delay, tick_t duration);
  */
 bool_t delayRead(delay_t * delay);
 
+/**
+ * @brief Verifica si ha terminado el retardo en un instante dado
+ * @param delay Puntero a la estructura delay_t a verificar
+ * @param now Tick actual, leído una sola vez por el llamador para todos sus retardos
+ * @return true si el retardo ha terminado, false en caso contrario
+ * @note Si el retardo no estaba corriendo, lo inicia en now
+ */
+bool_t delayReadAt(delay_t * delay, tick_t now);
+
+/**
+ * @brief Obtiene el tick actual del sistema
+ * @return Ticks transcurridos desde el arranque según la fuente de reloj
+ */
+tick_t delayGetTick(void);
+
+/**
+ * @brief Cambia la fuente de reloj de los retardos
+ * @param clock Función que devuelve el tick actual, o NULL para volver a DELAY_CLOCK
+ * @note La fuente debe contar a DELAY_TICK_HZ. Permite usar un contador de ciclos o un reloj
+ * simulado sin recompilar el módulo
+ */
+void delay_SetClock(delayClock_t clock);
+
 /**
  * @brief Cambia la duración de un retardo existente
  * @param delay Puntero a la estructura delay_t a modificar
- * @param duration Nueva duración del retardo en milisegundos
+ * @param duration Nueva duración del retardo en ticks, ajustada entre DELAY_MIN y DELAY_MAX
  */
 void delayWrite(delay_t * delay, tick_t duration);
 
+/**
+ * @brief Cambia la duración de un retardo sin ajustarla a DELAY_MIN
+ * @param delay Puntero a la estructura delay_t a modificar
+ * @param duration Nueva duración del retardo en ticks, ajustada solo a DELAY_MAX
+ * @details Para plazos internos, como los períodos de API_scheduler, que pueden ser más cortos
+ * que el mínimo de un retardo de la aplicación
+ */
+void delay_SetDuration(delay_t * delay, tick_t duration);
+
+/**
+ * @brief Inicia un retardo dentro del servicio de temporizadores
+ * @param delay Puntero a la estructura delay_t ya inicializada
+ * @param callback Función a llamar cuando venza el retardo, puede ser NULL
+ * @return true si se inició, false si el servicio ya tiene DELAY_SERVICE_SIZE retardos
+ * @details Si el retardo ya estaba en el servicio se reinicia desde el tick actual. Al vencer se
+ * quita del servicio, running pasa a false y se llama a callback, que puede volver a iniciarlo
+ */
+bool_t delayStart(delay_t * delay, delayCallback_t callback);
+
+/**
+ * @brief Inicia un retardo dentro del servicio de temporizadores en un instante dado
+ * @param delay Puntero a la estructura delay_t ya inicializada
+ * @param callback Función a llamar cuando venza el retardo, puede ser NULL
+ * @param now Tick en el que comienza el retardo
+ * @return true si se inició, false si el servicio ya tiene DELAY_SERVICE_SIZE retardos
+ */
+bool_t delayStartAt(delay_t * delay, delayCallback_t callback, tick_t now);
+
+/**
+ * @brief Quita un retardo del servicio de temporizadores sin llamar a su callback
+ * @param delay Puntero a la estructura delay_t
+ */
+void delayStop(delay_t * delay);
+
+/**
+ * @brief Vence en una sola pasada todos los retardos del servicio que ya cumplieron su duración
+ * @return Cantidad de retardos vencidos
+ * @details Lee el tick una sola vez. Los retardos se procesan en orden de vencimiento. Un retardo
+ * que su callback vuelve a iniciar ya vencido se procesa en la próxima llamada, así que un callback
+ * que se reprograma no deja la llamada en un ciclo sin fin; los demás vencidos se procesan igual
+ */
+uint16_t delayProcess(void);
+
+/**
+ * @brief Vence todos los retardos del servicio que cumplieron su duración en un instante dado
+ * @param now Tick actual
+ * @return Cantidad de retardos vencidos
+ */
+uint16_t delayProcessAt(tick_t now);
+
+/**
+ * @brief Obtiene el próximo vencimiento del servicio de temporizadores
+ * @param deadline Puntero donde se almacena el tick del vencimiento más cercano
+ * @return true si hay algún retardo en el servicio, false si está vacío
+ * @details Tiempo O(1). Permite dormir hasta deadline en lugar de consultar en un bucle
+ */
+bool_t delay_NextDeadline(tick_t * deadline);
+
 #ifdef __cplusplus
 }
 #endif
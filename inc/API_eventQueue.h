@@ -0,0 +1,151 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef API_INC_API_EVENTQUEUE_H_
+#define API_INC_API_EVENTQUEUE_H_
+
+/**
+ * @file API_eventQueue.h
+ * @brief Cola circular sin bloqueo de eventos de antirrebote con marca de tiempo
+ * @details Cola de un productor y un consumidor (SPSC) de capacidad fija. El productor puede
+ * ejecutarse en una interrupción o en otro hilo: solo usa atomics de C11, sin locks ni memoria
+ * dinámica. Cuando la cola está llena el evento se descarta y se cuenta como desborde.
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions ================================================================ */
+#ifndef __STDINT_H_
+#include <stdint.h>
+#endif
+
+#ifndef __STDBOOL_H_
+#include <stdbool.h>
+#endif
+
+#include <stdatomic.h>
+
+#include "API_delay.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+/**
+ * @def EVENT_QUEUE_SIZE
+ * @brief Capacidad de la cola en eventos, debe ser potencia de 2
+ */
+#ifndef EVENT_QUEUE_SIZE
+#define EVENT_QUEUE_SIZE 32
+#endif
+
+/* === Public data type declarations =========================================================== */
+/**
+ * @enum eventEdge_t
+ * @brief Tipo de flanco confirmado por el antirrebote
+ */
+typedef enum {
+    EVENT_NONE,     /**< Sin evento */
+    EVENT_PRESSED,  /**< Flanco descendente confirmado (botón presionado) */
+    EVENT_RELEASED, /**< Flanco ascendente confirmado (botón liberado) */
+} eventEdge_t;
+
+/**
+ * @struct event_t
+ * @brief Evento de antirrebote
+ */
+typedef struct {
+    uint16_t device; /**< Dispositivo o entrada que generó el evento */
+    uint8_t edge;    /**< Flanco confirmado, un valor de eventEdge_t */
+    tick_t tick;     /**< Tick en el que se confirmó el evento */
+} event_t;
+
+/**
+ * @struct eventQueue_t
+ * @brief Cola circular de eventos de un productor y un consumidor
+ */
+typedef struct {
+    event_t buffer[EVENT_QUEUE_SIZE];
+    atomic_uint_least32_t head;      /**< Eventos escritos, solo lo modifica el productor */
+    atomic_uint_least32_t tail;      /**< Eventos leídos, solo lo modifica el consumidor */
+    atomic_uint_least32_t overflows; /**< Eventos descartados por cola llena */
+    atomic_uint_least16_t highWater; /**< Máxima ocupación observada */
+} eventQueue_t;
+
+/**
+ * @struct eventQueueStats_t
+ * @brief Contadores de uso de una cola para dimensionarla con datos de campo
+ */
+typedef struct {
+    uint32_t pushed;    /**< Eventos aceptados desde la inicialización */
+    uint32_t overflows; /**< Eventos descartados por cola llena */
+    uint16_t highWater; /**< Máxima ocupación observada */
+} eventQueueStats_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+/**
+ * @brief Inicializa una cola vacía
+ * @param queue Puntero a la cola a inicializar
+ * @note Una cola estática sin inicializar ya está vacía
+ */
+void eventQueue_Init(eventQueue_t * queue);
+
+/**
+ * @brief Agrega un evento a la cola (lado productor)
+ * @param queue Puntero a la cola
+ * @param event Evento a copiar en la cola
+ * @return true si se encoló, false si la cola estaba llena y el evento se descartó
+ * @note Se puede llamar desde una interrupción u otro hilo que sea el único productor
+ */
+bool_t eventQueue_Push(eventQueue_t * queue, const event_t * event);
+
+/**
+ * @brief Extrae el evento más antiguo de la cola (lado consumidor)
+ * @param queue Puntero a la cola
+ * @param event Puntero donde se copia el evento extraído
+ * @return true si se extrajo un evento, false si la cola estaba vacía
+ */
+bool_t eventQueue_Pop(eventQueue_t * queue, event_t * event);
+
+/**
+ * @brief Cantidad de eventos pendientes de leer
+ * @param queue Puntero a la cola
+ * @return Eventos en la cola
+ */
+uint16_t eventQueue_Count(eventQueue_t * queue);
+
+/**
+ * @brief Obtiene los contadores de uso de la cola
+ * @param queue Puntero a la cola
+ * @param stats Puntero donde se copian los contadores
+ */
+void eventQueue_GetStats(eventQueue_t * queue, eventQueueStats_t * stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* API_INC_API_EVENTQUEUE_H_ */
@@ -0,0 +1,178 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+#ifndef API_INC_API_GESTURE_H_
+#define API_INC_API_GESTURE_H_
+
+/**
+ * @file API_gesture.h
+ * @brief Gestos (click, doble click, pulsación larga y repetición) sobre los flancos confirmados
+ * por el antirrebote
+ * @details Cada entrada guarda su estado en una gesture_t sin memoria dinámica: un retardo del
+ * servicio de temporizadores de API_delay, el estado del gesto y su identificador. Cada flanco se
+ * procesa en O(1) y los vencimientos los dispara delayProcess(), así que no hace falta consultar el
+ * tick en el lazo principal. Los tiempos y la función que recibe los gestos se comparten entre
+ * entradas mediante un gestureConfig_t.
+ *
+ * | Gesto                | Se emite                                                            |
+ * |----------------------|---------------------------------------------------------------------|
+ * | GESTURE_CLICK        | Al vencer dobleClick sin una segunda presión (o al soltar si es 0)  |
+ * | GESTURE_DOUBLE_CLICK | En la segunda presión, si llega antes de dobleClick                 |
+ * | GESTURE_LONG_PRESS   | Al mantener presionado pulsacionLarga; al soltar no hay click       |
+ * | GESTURE_REPEAT       | Cada repeticion mientras siga presionado después de la larga        |
+ *
+ * Las duraciones se ajustan entre DELAY_MIN y DELAY_MAX como en cualquier delay_t. Cada entrada
+ * con un vencimiento pendiente ocupa un lugar del servicio de temporizadores, así que
+ * DELAY_SERVICE_SIZE debe alcanzar para todas las entradas más los demás retardos del servicio;
+ * gesture_Feed() devuelve false si no lo hay.
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions ================================================================ */
+#ifndef __STDINT_H_
+#include <stdint.h>
+#endif
+
+#include "API_delay.h"
+#include "API_eventQueue.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+/**
+ * @def GESTURE_LARGA_MS
+ * @brief Tiempo presionado por defecto para una pulsación larga, en milisegundos
+ */
+#ifndef GESTURE_LARGA_MS
+#define GESTURE_LARGA_MS 800
+#endif
+
+/**
+ * @def GESTURE_DOBLE_MS
+ * @brief Tiempo máximo por defecto entre soltar y volver a presionar para un doble click
+ */
+#ifndef GESTURE_DOBLE_MS
+#define GESTURE_DOBLE_MS 300
+#endif
+
+/**
+ * @def GESTURE_REPETICION_MS
+ * @brief Período por defecto de la repetición automática, en milisegundos
+ */
+#ifndef GESTURE_REPETICION_MS
+#define GESTURE_REPETICION_MS 100
+#endif
+
+/**
+ * @def GESTURE_CONFIG_DEFAULT
+ * @brief Inicializador de gestureConfig_t con los tiempos por defecto
+ */
+#define GESTURE_CONFIG_DEFAULT(fn, ctx)                                                            \
+    {DELAY_MS(GESTURE_LARGA_MS), DELAY_MS(GESTURE_DOBLE_MS), DELAY_MS(GESTURE_REPETICION_MS),      \
+     (fn), (ctx)}
+
+/* === Public data type declarations =========================================================== */
+/**
+ * @enum gestureEvent_t
+ * @brief Gestos reconocidos
+ */
+typedef enum {
+    GESTURE_NONE,         /**< Sin gesto */
+    GESTURE_CLICK,        /**< Presión corta sin segunda presión */
+    GESTURE_DOUBLE_CLICK, /**< Dos presiones cortas seguidas */
+    GESTURE_LONG_PRESS,   /**< Presión mantenida */
+    GESTURE_REPEAT,       /**< Repetición mientras se mantiene la presión larga */
+} gestureEvent_t;
+
+/** @brief Entrada con gestos, definida más abajo */
+typedef struct gesture_s gesture_t;
+
+/**
+ * @typedef gestureCallback_t
+ * @brief Función que recibe cada gesto
+ * @param gesture Entrada que generó el gesto
+ * @param evento Gesto reconocido
+ * @param tick Tick del flanco o del vencimiento que lo originó
+ * @param contexto Puntero de gestureConfig_t
+ */
+typedef void (*gestureCallback_t)(gesture_t * gesture, gestureEvent_t evento, tick_t tick,
+                                  void * contexto);
+
+/**
+ * @struct gestureConfig_t
+ * @brief Tiempos y destino de los gestos, compartidos por todas las entradas que lo usan
+ */
+typedef struct {
+    tick_t pulsacionLarga;      /**< Presión para GESTURE_LONG_PRESS, 0 la deshabilita */
+    tick_t dobleClick;          /**< Ventana para GESTURE_DOUBLE_CLICK, 0 la deshabilita */
+    tick_t repeticion;          /**< Período de GESTURE_REPEAT, 0 la deshabilita */
+    gestureCallback_t callback; /**< Función que recibe los gestos */
+    void * contexto;            /**< Argumento de callback */
+} gestureConfig_t;
+
+/**
+ * @struct gesture_s
+ * @brief Estado de los gestos de una entrada
+ */
+struct gesture_s {
+    delay_t temporizador;           /**< Próximo vencimiento, debe ser el primer miembro */
+    const gestureConfig_t * config; /**< Tiempos y destino de los gestos */
+    uint16_t id;                    /**< Identificador de la entrada, por ejemplo el dispositivo */
+    uint8_t estado;                 /**< Estado interno del reconocedor */
+};
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+/**
+ * @brief Inicializa una entrada en reposo
+ * @param gesture Entrada a inicializar
+ * @param id Identificador de la entrada
+ * @param config Tiempos y destino de los gestos, debe seguir existiendo mientras se use
+ * @note No se debe usar sobre una entrada con un vencimiento pendiente (ver gesture_Reset())
+ */
+void gesture_Init(gesture_t * gesture, uint16_t id, const gestureConfig_t * config);
+
+/**
+ * @brief Procesa un flanco confirmado por el antirrebote
+ * @param gesture Entrada que cambió
+ * @param edge EVENT_PRESSED o EVENT_RELEASED, otros valores se ignoran
+ * @param tick Tick en el que se confirmó el flanco, por ejemplo event_t.tick
+ * @return false si el servicio de temporizadores estaba lleno y no se pudo programar el
+ * vencimiento del gesto: sin él no hay pulsación larga ni repetición para esta presión, y al
+ * soltar el click se informa enseguida sin esperar un doble click
+ */
+bool_t gesture_Feed(gesture_t * gesture, eventEdge_t edge, tick_t tick);
+
+/**
+ * @brief Vuelve la entrada al reposo y quita su vencimiento del servicio de temporizadores
+ */
+void gesture_Reset(gesture_t * gesture);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* API_INC_API_GESTURE_H_ */
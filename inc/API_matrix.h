@@ -0,0 +1,163 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+#ifndef API_INC_API_MATRIX_H_
+#define API_INC_API_MATRIX_H_
+
+/**
+ * @file API_matrix.h
+ * @brief Barrido de teclados matriciales con antirrebote, detección de fantasmas y reportes de
+ * cambios
+ * @details Cada barrido activa una columna por vez con IO_WriteMask() e IO_Flush(), de modo que
+ * pasar de una columna a la siguiente es una sola escritura de BSRR por puerto, y lee todas las
+ * filas con un IO_ReadMany(). La matriz cruda pasa por API_debounceBank, así que cualquier cantidad
+ * de teclas puede estar presionada a la vez (N-key rollover) mientras no formen un rectángulo.
+ *
+ * Sin diodos, tres teclas en tres esquinas de un rectángulo hacen aparecer la cuarta. Cuando dos
+ * columnas comparten dos o más filas presionadas no se puede saber cuáles son reales, así que esas
+ * teclas conservan el estado del barrido anterior hasta que la ambigüedad desaparece.
+ *
+ * La tecla de la fila f y la columna c tiene el código f * columnas + c.
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions ================================================================ */
+#ifndef __STDINT_H_
+#include <stdint.h>
+#endif
+
+#include "API_IO.h"
+#include "API_debounceBank.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+/** @brief Cantidad máxima de columnas de una matriz */
+#define MATRIX_MAX_COLUMNS 8
+/** @brief Cantidad máxima de filas de una matriz */
+#define MATRIX_MAX_ROWS 8
+/** @brief Cantidad máxima de teclas de una matriz */
+#define MATRIX_MAX_KEYS (MATRIX_MAX_COLUMNS * MATRIX_MAX_ROWS)
+
+/** @brief Bit de una entrada de matrixReport_t que indica presión (0 = liberación) */
+#define MATRIX_KEY_PRESSED 0x80u
+/** @brief Extrae el código de tecla de una entrada de matrixReport_t */
+#define MATRIX_KEY_CODE(entrada) ((uint8_t)((entrada) & 0x7Fu))
+
+#if IO_KEYPAD
+/** @brief Columnas del teclado de 4x4 de IO_KEYPAD_TABLE, para matrix_Init() */
+#define MATRIX_KEYPAD_COLUMNS {IO_KEY_COL0, IO_KEY_COL1, IO_KEY_COL2, IO_KEY_COL3}
+/** @brief Filas del teclado de 4x4 de IO_KEYPAD_TABLE, para matrix_Init() */
+#define MATRIX_KEYPAD_ROWS {IO_KEY_ROW0, IO_KEY_ROW1, IO_KEY_ROW2, IO_KEY_ROW3}
+#endif
+
+/* === Public data type declarations =========================================================== */
+/**
+ * @typedef matrixSettle_t
+ * @brief Espera entre activar una columna y leer las filas, para que las líneas se estabilicen
+ * @param contexto Puntero registrado con matrix_SetSettle()
+ */
+typedef void (*matrixSettle_t)(void * contexto);
+
+/**
+ * @struct matrixReport_t
+ * @brief Teclas que cambiaron en un barrido, una entrada por tecla
+ */
+typedef struct {
+    uint8_t cantidad;                /**< Entradas válidas */
+    uint8_t teclas[MATRIX_MAX_KEYS]; /**< Código de tecla, con MATRIX_KEY_PRESSED si se presionó */
+} matrixReport_t;
+
+/**
+ * @struct matrix_t
+ * @brief Estado de una matriz de teclas
+ */
+typedef struct {
+    IO_Device_t columnas[MATRIX_MAX_COLUMNS]; /**< Salidas que activan cada columna */
+    IO_Device_t filas[MATRIX_MAX_ROWS];       /**< Entradas de cada fila */
+    uint8_t numColumnas;                      /**< Columnas en uso */
+    uint8_t numFilas;                         /**< Filas en uso */
+    IO_Snapshot_t mascaraColumnas;            /**< Todas las columnas, para apagarlas juntas */
+    matrixSettle_t esperar;                   /**< Espera antes de leer las filas, o NULL */
+    void * contexto;                          /**< Argumento de esperar */
+    uint64_t crudo;                           /**< Matriz filtrada del último barrido */
+    uint32_t fantasmas;                       /**< Barridos con teclas ambiguas */
+    debounceBank_t bank;                      /**< Antirrebote de todas las teclas */
+    debounceBank_word_t bits[DEBOUNCE_BANK_BITS(MATRIX_MAX_KEYS)]; /**< Planos de bank */
+    tick_t vencimientos[MATRIX_MAX_KEYS];                          /**< Vencimientos de bank */
+} matrix_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+/**
+ * @brief Inicializa una matriz con todas las teclas liberadas
+ * @param matrix Matriz a inicializar
+ * @param columnas Dispositivos de salida de cada columna
+ * @param numColumnas Cantidad de columnas, hasta MATRIX_MAX_COLUMNS
+ * @param filas Dispositivos de entrada de cada fila
+ * @param numFilas Cantidad de filas, hasta MATRIX_MAX_ROWS
+ * @param duracion Retardo de antirrebote en ticks, por ejemplo DELAY_MS(TIEMPO_RETARDO)
+ * @return true si se inicializó, false si las dimensiones o algún dispositivo no son válidos
+ * @note Requiere IO_Init() para poder escribir las columnas
+ */
+bool_t matrix_Init(matrix_t * matrix, const IO_Device_t * columnas, uint8_t numColumnas,
+                   const IO_Device_t * filas, uint8_t numFilas, tick_t duracion);
+
+/**
+ * @brief Registra la espera entre activar una columna y leer las filas
+ * @param matrix Matriz a configurar
+ * @param esperar Función de espera, o NULL para leer inmediatamente
+ * @param contexto Puntero que se pasa a esperar sin modificar
+ */
+void matrix_SetSettle(matrix_t * matrix, matrixSettle_t esperar, void * contexto);
+
+/**
+ * @brief Barre todas las columnas, actualiza el antirrebote y arma el reporte de cambios
+ * @param matrix Matriz a barrer
+ * @param now Tick actual
+ * @param reporte Puntero donde se almacenan las teclas que cambiaron, o NULL para descartarlas
+ * @return Cantidad de teclas que cambiaron
+ */
+uint8_t matrix_Scan(matrix_t * matrix, tick_t now, matrixReport_t * reporte);
+
+/**
+ * @brief Indica si una tecla está presionada según el antirrebote
+ * @param matrix Matriz a consultar
+ * @param tecla Código de la tecla
+ * @return true si la tecla está en BUTTON_DOWN o BUTTON_RISING
+ */
+bool_t matrix_IsPressed(const matrix_t * matrix, uint8_t tecla);
+
+/**
+ * @brief Cantidad de barridos en los que se descartaron teclas por ambigüedad
+ */
+uint32_t matrix_GhostCount(const matrix_t * matrix);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* API_INC_API_MATRIX_H_ */
@@ -0,0 +1,237 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+#ifndef API_INC_API_SCHEDULER_H_
+#define API_INC_API_SCHEDULER_H_
+
+/**
+ * @file API_scheduler.h
+ * @brief Planificador cooperativo de tareas periódicas y esporádicas para el lazo principal
+ * @details Cada tarea es un protohilo: una función que se reanuda donde cedió el procesador con
+ * SCHEDULER_YIELD() o SCHEDULER_WAIT_UNTIL() y que termina su trabajo con SCHEDULER_END(). Las
+ * activaciones periódicas las dispara el servicio de temporizadores de API_delay, ordenado por
+ * vencimiento, así que el planificador no recorre las tareas para saber cuál vence. Las tareas se
+ * guardan en una schedulerTask_t del llamador, sin memoria dinámica.
+ *
+ * En cada pasada se despacha siempre la tarea lista de mayor prioridad que todavía no avanzó en
+ * esa pasada. Entre tareas de igual prioridad va primero la de menor período (rate-monotonic), de
+ * modo que registrar todas con la misma prioridad da la asignación rate-monotonic clásica.
+ *
+ * Se cuenta como sobrecarga cada activación que llega con el trabajo anterior sin terminar y cada
+ * trabajo que termina después de su plazo. Los tiempos de ejecución y la latencia se miden con
+ * delayGetTick(), con la resolución de DELAY_TICK_HZ o de la fuente de delay_SetClock().
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions ================================================================ */
+#ifndef __STDINT_H_
+#include <stdint.h>
+#endif
+
+#include "API_delay.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+/**
+ * @def SCHEDULER_MAX_TAREAS
+ * @brief Cantidad máxima de tareas registradas a la vez
+ */
+#ifndef SCHEDULER_MAX_TAREAS
+#define SCHEDULER_MAX_TAREAS 16
+#endif
+
+/**
+ * @brief Comienza el cuerpo de un protohilo
+ * @note Las variables locales no se conservan entre pasos: el estado va en el contexto
+ */
+#define SCHEDULER_BEGIN(tarea)                                                                     \
+    switch ((tarea)->linea) {                                                                      \
+    case 0:
+
+/** @brief Cede el procesador, el trabajo sigue en la próxima pasada desde este punto */
+#define SCHEDULER_YIELD(tarea)                                                                     \
+    do {                                                                                           \
+        (tarea)->linea = __LINE__;                                                                 \
+        return SCHEDULER_YIELDED;                                                                  \
+    case __LINE__:;                                                                                \
+    } while (0)
+
+/** @brief Cede el procesador en cada pasada mientras no se cumpla la condición */
+#define SCHEDULER_WAIT_UNTIL(tarea, condicion)                                                     \
+    do {                                                                                           \
+        (tarea)->linea = __LINE__;                                                                 \
+    case __LINE__:                                                                                 \
+        if (!(condicion)) {                                                                        \
+            return SCHEDULER_YIELDED;                                                              \
+        }                                                                                          \
+    } while (0)
+
+/** @brief Termina el trabajo de la activación en curso, el próximo comienza desde el principio */
+#define SCHEDULER_END(tarea)                                                                       \
+    }                                                                                              \
+    (tarea)->linea = 0;                                                                            \
+    return SCHEDULER_DONE
+
+/* === Public data type declarations =========================================================== */
+/**
+ * @enum schedulerResult_t
+ * @brief Resultado de un paso de una tarea
+ */
+typedef enum {
+    SCHEDULER_YIELDED, /**< El trabajo cedió el procesador y sigue en la próxima pasada */
+    SCHEDULER_DONE,    /**< El trabajo de la activación en curso terminó */
+} schedulerResult_t;
+
+/** @brief Tarea del planificador, definida más abajo */
+typedef struct schedulerTask_s schedulerTask_t;
+
+/**
+ * @typedef schedulerTaskFn_t
+ * @brief Cuerpo de una tarea, escrito entre SCHEDULER_BEGIN() y SCHEDULER_END()
+ * @param tarea Tarea que se ejecuta
+ * @param contexto Puntero indicado en scheduler_Add()
+ * @return SCHEDULER_YIELDED o SCHEDULER_DONE
+ */
+typedef schedulerResult_t (*schedulerTaskFn_t)(schedulerTask_t * tarea, void * contexto);
+
+/**
+ * @struct schedulerStats_t
+ * @brief Estadísticas de una tarea, en ticks de delayGetTick()
+ */
+typedef struct {
+    uint32_t ejecuciones;    /**< Trabajos terminados */
+    uint32_t sobrecargas;    /**< Activaciones perdidas más trabajos terminados fuera de plazo */
+    tick_t ejecucionMax;     /**< Mayor tiempo de ejecución de un trabajo, sumando sus pasos */
+    uint64_t ejecucionTotal; /**< Tiempo de ejecución de todos los trabajos terminados */
+    tick_t latenciaMax;      /**< Mayor atraso entre una activación y el primer paso del trabajo */
+} schedulerStats_t;
+
+/**
+ * @struct schedulerTask_s
+ * @brief Estado de una tarea
+ */
+struct schedulerTask_s {
+    delay_t temporizador;          /**< Próxima activación periódica, debe ser el primer miembro */
+    schedulerTaskFn_t funcion;     /**< Cuerpo de la tarea */
+    void * contexto;               /**< Argumento de funcion */
+    tick_t periodo;                /**< Ticks entre activaciones, 0 si es esporádica */
+    tick_t plazo;                  /**< Ticks desde la activación para terminar, 0 sin plazo */
+    tick_t activacion;             /**< Tick de la activación del trabajo en curso */
+    tick_t ejecucion;              /**< Tiempo de ejecución acumulado por el trabajo en curso */
+    uint32_t pasada;               /**< Última pasada del planificador en la que avanzó */
+    uint16_t linea;                /**< Punto de reanudación del protohilo, 0 al comenzar */
+    uint8_t prioridad;             /**< 0 es la más alta */
+    bool_t lista;                  /**< Tiene un trabajo activado sin terminar */
+    bool_t iniciada;               /**< El trabajo en curso ya dio su primer paso */
+    volatile bool_t aviso;         /**< Activación pedida con scheduler_Activate() */
+    schedulerStats_t estadisticas; /**< Sobrecargas y tiempos medidos */
+};
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+/**
+ * @brief Quita todas las tareas registradas y sus activaciones pendientes
+ */
+void scheduler_Init(void);
+
+/**
+ * @brief Registra una tarea
+ * @param tarea Tarea a registrar, debe seguir existiendo mientras esté registrada
+ * @param funcion Cuerpo de la tarea
+ * @param contexto Puntero que se entrega a funcion
+ * @param periodo Ticks entre activaciones, hasta DELAY_MAX, o 0 para una tarea esporádica
+ * @param plazo Ticks desde la activación para terminar el trabajo, 0 toma el período
+ * @param prioridad 0 es la más alta; a igual prioridad va primero la de menor período
+ * @return false si ya está registrada, si los parámetros no son válidos, si se alcanzó
+ * SCHEDULER_MAX_TAREAS o si el servicio de temporizadores está lleno
+ * @details Una tarea periódica queda activada en el tick actual. El período no se ajusta a
+ * DELAY_MIN (ver delay_SetDuration()), así que el antirrebote puede muestrear cada pocos
+ * milisegundos
+ */
+bool_t scheduler_Add(schedulerTask_t * tarea, schedulerTaskFn_t funcion, void * contexto,
+                     tick_t periodo, tick_t plazo, uint8_t prioridad);
+
+/**
+ * @brief Quita una tarea registrada y su próxima activación
+ * @param tarea Tarea a quitar; puede llamarse desde su propio cuerpo
+ */
+void scheduler_Remove(schedulerTask_t * tarea);
+
+/**
+ * @brief Pide una activación de una tarea
+ * @param tarea Tarea registrada
+ * @details Solo marca el pedido, así que puede llamarse desde una interrupción. La próxima
+ * pasada activa la tarea, o al terminar el trabajo en curso si lo tiene, y si es periódica y estaba
+ * suspendida vuelve a programar sus activaciones a partir de ese tick
+ */
+void scheduler_Activate(schedulerTask_t * tarea);
+
+/**
+ * @brief Detiene las activaciones periódicas de una tarea hasta el próximo scheduler_Activate()
+ * @param tarea Tarea registrada; el trabajo en curso, si lo hay, sigue hasta terminar
+ */
+void scheduler_Suspend(schedulerTask_t * tarea);
+
+/**
+ * @brief Ejecuta una pasada del planificador
+ * @return true si quedó algún trabajo sin terminar, que sigue en la próxima pasada
+ * @details Vence los retardos del servicio de temporizadores, incluidos los que no son de tareas,
+ * y da un paso a cada tarea lista en orden de prioridad. Luego de cada paso vuelve a vencer los
+ * retardos, así que una activación de mayor prioridad se atiende antes que el resto de la pasada
+ */
+bool_t scheduler_Run(void);
+
+/**
+ * @brief Duerme hasta el próximo vencimiento del servicio de temporizadores o un aviso
+ * @details Si ya venció algo o hay un scheduler_Activate() pendiente vuelve enseguida. Sin
+ * vencimientos detiene el SysTick, de modo que solo una interrupción que llame a
+ * scheduler_Activate() despierta al planificador
+ */
+void scheduler_Idle(void);
+
+/**
+ * @brief Lazo principal: alterna pasadas del planificador y reposo, no retorna
+ */
+void scheduler_Loop(void);
+
+/**
+ * @brief Obtiene las estadísticas de una tarea
+ * @param tarea Tarea a consultar
+ * @param stats Estructura donde se copian las estadísticas
+ */
+void scheduler_GetStats(const schedulerTask_t * tarea, schedulerStats_t * stats);
+
+/**
+ * @brief Pone en cero las estadísticas de una tarea
+ */
+void scheduler_ResetStats(schedulerTask_t * tarea);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* API_INC_API_SCHEDULER_H_ */
@@ -0,0 +1,181 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef API_INC_API_TRACE_H_
+#define API_INC_API_TRACE_H_
+
+/**
+ * @file API_trace.h
+ * @brief Captura de trazas de entradas y reproducción acelerada a través del antirrebote
+ * @details Una traza guarda las muestras crudas de las entradas con su tick, codificadas por
+ * diferencias: solo se escribe un registro cuando cambia alguna entrada, con el tiempo
+ * transcurrido y los bits que cambiaron como enteros de largo variable (LEB128). Un rebote de
+ * pocos ticks ocupa dos o tres bytes y un período estable de horas no ocupa nada.
+ *
+ * Formato: "DBTR", versión (1 byte), tick inicial, muestra inicial y luego registros
+ * {delta de ticks, bits cambiados}. Un registro con bits cambiados en cero marca el final de la
+ * traza y su delta el tick final.
+ *
+ * La reproducción alimenta las instancias de antirrebote en tiempo virtual: salta directo al
+ * próximo cambio cuando ninguna instancia está resolviendo un rebote, por lo que horas de
+ * captura se reproducen en fracciones de segundo.
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions ================================================================ */
+#ifndef __STDINT_H_
+#include <stdint.h>
+#endif
+
+#include "API_debounce.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+/** @brief Versión del formato de traza que escribe y acepta este módulo */
+#define TRACE_VERSION 1
+
+/** @brief Largo máximo de la cabecera de una traza en bytes */
+#define TRACE_HEADER_MAX (4 + 1 + 5 + 5)
+
+/* === Public data type declarations =========================================================== */
+/**
+ * @struct trace_t
+ * @brief Traza en escritura sobre un buffer provisto por el usuario
+ */
+typedef struct {
+    uint8_t * buffer;             /**< Memoria donde se codifica la traza */
+    uint32_t capacidad;           /**< Tamaño del buffer en bytes */
+    uint32_t largo;               /**< Bytes escritos */
+    tick_t ultimoTick;            /**< Tick del último registro escrito */
+    IO_Snapshot_t ultimaMuestra;  /**< Última muestra escrita */
+    uint32_t descartadas;         /**< Muestras con cambios perdidas por falta de espacio */
+    bool_t cerrada;               /**< Se escribió la marca de final */
+} trace_t;
+
+/**
+ * @struct traceReader_t
+ * @brief Lector secuencial de una traza
+ */
+typedef struct {
+    const uint8_t * buffer;       /**< Traza codificada */
+    uint32_t largo;               /**< Tamaño de la traza en bytes */
+    uint32_t posicion;            /**< Próximo byte a decodificar */
+    tick_t inicio;                /**< Tick inicial de la traza */
+    IO_Snapshot_t inicial;        /**< Muestra inicial de la traza */
+    tick_t tick;                  /**< Tick del último registro leído */
+    IO_Snapshot_t muestra;        /**< Muestra vigente después del último registro leído */
+    bool_t completa;              /**< Se leyó la marca de final, tick es el tick final */
+} traceReader_t;
+
+/**
+ * @typedef traceEventCallback_t
+ * @brief Función que recibe cada evento confirmado durante una reproducción
+ * @param event Evento confirmado, con el tick virtual en el que se confirmó
+ * @param ctx Puntero de usuario pasado a trace_Replay()
+ */
+typedef void (*traceEventCallback_t)(const event_t * event, void * ctx);
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+/**
+ * @brief Inicia una traza vacía y escribe su cabecera
+ * @param trace Traza a iniciar
+ * @param buffer Memoria donde se codifica la traza
+ * @param capacidad Tamaño del buffer en bytes
+ * @param inicio Tick de la muestra inicial
+ * @param inicial Estado de las entradas al iniciar la captura
+ * @return true si la cabecera entra en el buffer
+ */
+bool_t trace_InitWriter(trace_t * trace, uint8_t * buffer, uint32_t capacidad, tick_t inicio,
+                        IO_Snapshot_t inicial);
+
+/**
+ * @brief Agrega una muestra a la traza
+ * @param trace Traza en escritura
+ * @param tick Tick de la muestra, no anterior al de la muestra previa
+ * @param muestra Estado de las entradas
+ * @return false si la muestra cambia alguna entrada y no entra en el buffer
+ * @note Las muestras iguales a la anterior no ocupan espacio. Siempre queda lugar reservado para
+ * la marca de final, así que una traza llena sigue siendo válida hasta la última muestra grabada
+ */
+bool_t trace_Record(trace_t * trace, tick_t tick, IO_Snapshot_t muestra);
+
+/**
+ * @brief Escribe la marca de final de la traza
+ * @param trace Traza en escritura
+ * @param fin Tick en el que termina la captura
+ * @return true si no se descartó ninguna muestra
+ */
+bool_t trace_Finish(trace_t * trace, tick_t fin);
+
+/**
+ * @brief Comienza a grabar en una traza todas las lecturas de la capa IO
+ * @param trace Traza iniciada con trace_InitWriter(), o NULL para dejar de grabar
+ * @note Cada muestra se marca con delayGetTick()
+ */
+void trace_Attach(trace_t * trace);
+
+/**
+ * @brief Inicia la lectura de una traza y valida su cabecera
+ * @param reader Lector a iniciar
+ * @param buffer Traza codificada
+ * @param largo Tamaño de la traza en bytes
+ * @return false si la cabecera no es válida o la versión no es soportada
+ */
+bool_t trace_InitReader(traceReader_t * reader, const uint8_t * buffer, uint32_t largo);
+
+/**
+ * @brief Lee el próximo cambio de la traza
+ * @param reader Lector iniciado con trace_InitReader()
+ * @param tick Puntero donde se copia el tick del cambio
+ * @param muestra Puntero donde se copia el estado de las entradas desde ese tick
+ * @return false al llegar al final; reader->completa indica si la traza terminó bien
+ */
+bool_t trace_Next(traceReader_t * reader, tick_t * tick, IO_Snapshot_t * muestra);
+
+/**
+ * @brief Reproduce una traza a través de instancias de antirrebote en tiempo virtual
+ * @param reader Lector iniciado con trace_InitReader() y sin registros leídos
+ * @param instancias Instancias iniciadas con debounce_Init(), una por dispositivo a observar
+ * @param cantidad Cantidad de instancias
+ * @param periodo Ticks entre llamadas de actualización simuladas
+ * @param callback Función que recibe cada evento confirmado, puede ser NULL
+ * @param ctx Puntero de usuario para el callback
+ * @return Cantidad de eventos confirmados
+ * @note Las instancias pasan a DEBOUNCE_MODE_INTERRUPT y los cambios de la traza se notifican como
+ * flancos. Los eventos pasan por la cola de debounce_ReadEvent(): no reproducir mientras la
+ * aplicación consume eventos
+ */
+uint32_t trace_Replay(traceReader_t * reader, debounce_t * instancias, uint16_t cantidad,
+                      tick_t periodo, traceEventCallback_t callback, void * ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* API_INC_API_TRACE_H_ */
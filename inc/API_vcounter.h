@@ -0,0 +1,134 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef API_INC_API_VCOUNTER_H_
+#define API_INC_API_VCOUNTER_H_
+
+/**
+ * @file API_vcounter.h
+ * @brief Antirrebote por contadores verticales para 32/64 entradas en paralelo
+ * @details Cada bit de la palabra es una entrada independiente. El contador de cada entrada está
+ * repartido en dos palabras (cnt0/cnt1), por lo que una actualización procesa todas las
+ * entradas con unas pocas operaciones AND/XOR.
+ *
+ * Equivalencia con los estados de la FSM de API_debounce:
+ * | estado | contador | Estado FSM     |
+ * |--------|----------|----------------|
+ * | 0      | reposo   | BUTTON_UP      |
+ * | 0      | contando | BUTTON_FALLING |
+ * | 1      | reposo   | BUTTON_DOWN    |
+ * | 1      | contando | BUTTON_RISING  |
+ *
+ * Un cambio se confirma tras VCOUNTER_MUESTRAS muestras consecutivas distintas del estado
+ * estable; una muestra igual al estado estable aborta el conteo, igual que la vuelta de
+ * BUTTON_FALLING a BUTTON_UP. Para igualar a la FSM se debe muestrear cada
+ * TIEMPO_RETARDO / VCOUNTER_MUESTRAS milisegundos.
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions ================================================================ */
+#ifndef __STDINT_H_
+#include <stdint.h>
+#endif
+
+#ifndef __STDBOOL_H_
+#include <stdbool.h>
+#endif
+
+#include "API_debounce.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+/**
+ * @def VCOUNTER_WIDTH
+ * @brief Cantidad de entradas por palabra (32 o 64)
+ */
+#ifndef VCOUNTER_WIDTH
+#define VCOUNTER_WIDTH 32
+#endif
+
+/**
+ * @def VCOUNTER_MUESTRAS
+ * @brief Muestras consecutivas necesarias para confirmar un cambio
+ */
+#define VCOUNTER_MUESTRAS 4
+
+/* === Public data type declarations =========================================================== */
+#if VCOUNTER_WIDTH == 64
+/** @brief Palabra con una entrada por bit */
+typedef uint64_t vcounter_word_t;
+#elif VCOUNTER_WIDTH == 32
+/** @brief Palabra con una entrada por bit */
+typedef uint32_t vcounter_word_t;
+#else
+#error "VCOUNTER_WIDTH debe ser 32 o 64"
+#endif
+
+/**
+ * @struct vcounter_t
+ * @brief Estado de antirrebote de hasta VCOUNTER_WIDTH entradas
+ */
+typedef struct {
+    vcounter_word_t estado; /**< Estado estable de cada entrada (1 = presionada) */
+    vcounter_word_t cnt0;   /**< Bit 0 del contador de cada entrada */
+    vcounter_word_t cnt1;   /**< Bit 1 del contador de cada entrada */
+} vcounter_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+/**
+ * @brief Inicializa el antirrebote con un estado estable conocido
+ * @param vcounter Puntero a la estructura a inicializar
+ * @param inicial Estado estable inicial de cada entrada (0 = todas en BUTTON_UP)
+ */
+void vcounter_Init(vcounter_t * vcounter, vcounter_word_t inicial);
+
+/**
+ * @brief Procesa una muestra de todas las entradas
+ * @param vcounter Puntero a la estructura a actualizar
+ * @param muestra Lectura cruda de las entradas (1 = presionada)
+ * @param pressed Puntero donde se almacena la máscara de flancos de presión confirmados
+ * @param released Puntero donde se almacena la máscara de flancos de liberación confirmados
+ * @return Máscara de entradas que cambiaron de estado estable en esta muestra
+ */
+vcounter_word_t vcounter_Update(vcounter_t * vcounter, vcounter_word_t muestra,
+                                vcounter_word_t * pressed, vcounter_word_t * released);
+
+/**
+ * @brief Traduce el estado de una entrada a los estados de la FSM de API_debounce
+ * @param vcounter Puntero a la estructura a consultar
+ * @param entrada Número de bit de la entrada
+ * @return Estado equivalente de la FSM
+ */
+debounceState_t vcounter_State(const vcounter_t * vcounter, uint8_t entrada);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* API_INC_API_VCOUNTER_H_ */
@@ -0,0 +1,228 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef HAL_HOST_H
+#define HAL_HOST_H
+
+/**
+ * @file hal_host.h
+ * @brief Implementación de la HAL para ejecutar el firmware en Linux
+ * @details Reemplaza a stm32f4xx_hal.h cuando se compila con HAL_HOST. Los registros GPIO viven
+ * en una página que puede mapearse sobre memoria compartida (variable de entorno HAL_HOST_SHM), de
+ * modo que otro proceso pueda cambiar entradas y observar salidas sin copias. Un cambio en IDR
+ * notificado con SIGUSR1 se entrega como interrupción a HAL_GPIO_EXTI_Callback(), y SIGALRM
+ * emula el SysTick de 1 ms.
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions ================================================================ */
+#ifndef __STDINT_H_
+#include <stdint.h>
+#endif
+
+#ifndef __STDBOOL_H_
+#include <stdbool.h>
+#endif
+
+#include <stddef.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+/** @brief Cantidad de puertos GPIO emulados (GPIOA a GPIOH) */
+#define HAL_HOST_PORTS 8
+
+/** @brief Tamaño de la página de registros compartida */
+#define HAL_HOST_PAGE 4096
+
+/** @brief Valor de hal_host_regs.magic cuando la página está inicializada */
+#define HAL_HOST_MAGIC 0x48414C48u
+
+/** @brief Variable de entorno con el nombre del objeto de memoria compartida */
+#define HAL_HOST_SHM_ENV "HAL_HOST_SHM"
+
+#define GPIO_PIN_0   ((uint16_t)0x0001)
+#define GPIO_PIN_1   ((uint16_t)0x0002)
+#define GPIO_PIN_2   ((uint16_t)0x0004)
+#define GPIO_PIN_3   ((uint16_t)0x0008)
+#define GPIO_PIN_4   ((uint16_t)0x0010)
+#define GPIO_PIN_5   ((uint16_t)0x0020)
+#define GPIO_PIN_6   ((uint16_t)0x0040)
+#define GPIO_PIN_7   ((uint16_t)0x0080)
+#define GPIO_PIN_8   ((uint16_t)0x0100)
+#define GPIO_PIN_9   ((uint16_t)0x0200)
+#define GPIO_PIN_10  ((uint16_t)0x0400)
+#define GPIO_PIN_11  ((uint16_t)0x0800)
+#define GPIO_PIN_12  ((uint16_t)0x1000)
+#define GPIO_PIN_13  ((uint16_t)0x2000)
+#define GPIO_PIN_14  ((uint16_t)0x4000)
+#define GPIO_PIN_15  ((uint16_t)0x8000)
+#define GPIO_PIN_All ((uint16_t)0xFFFF)
+
+#ifndef GPIO_PIN_SET
+#define GPIO_PIN_SET   1
+#define GPIO_PIN_RESET 0
+#endif
+
+#define GPIOA (&hal_host_regs.gpio[0])
+#define GPIOB (&hal_host_regs.gpio[1])
+#define GPIOC (&hal_host_regs.gpio[2])
+#define GPIOD (&hal_host_regs.gpio[3])
+#define GPIOE (&hal_host_regs.gpio[4])
+#define GPIOF (&hal_host_regs.gpio[5])
+#define GPIOG (&hal_host_regs.gpio[6])
+#define GPIOH (&hal_host_regs.gpio[7])
+
+/** @brief Deshabilita las interrupciones emuladas (bloquea las señales) */
+#define __disable_irq() HAL_Host_DisableIrq()
+/** @brief Habilita las interrupciones emuladas */
+#define __enable_irq() HAL_Host_EnableIrq()
+/** @brief Duerme hasta la próxima interrupción emulada */
+#define __WFI() HAL_Host_WaitForInterrupt()
+/** @brief Escritura de BSRR que además actualiza ODR, como lo hace el puerto real */
+#define GPIO_WRITE_BSRR(GPIOx, valor) HAL_Host_WriteBSRR((GPIOx), (valor))
+
+/* === Public data type declarations =========================================================== */
+/** @brief Estado de un pin, compatible con la HAL de ST */
+typedef int GPIO_PinState;
+
+/** @brief Estado devuelto por las funciones de la HAL */
+typedef enum { HAL_OK, HAL_ERROR } HAL_StatusTypeDef;
+
+/**
+ * @struct GPIO_TypeDef
+ * @brief Registros emulados de un puerto GPIO
+ */
+typedef struct {
+    volatile uint32_t IDR;  /**< Entradas, las escribe el proceso que simula el hardware */
+    volatile uint32_t ODR;  /**< Salidas, las escribe el firmware */
+    volatile uint32_t BSRR; /**< Último valor escrito en el registro de set/reset */
+} GPIO_TypeDef;
+
+/**
+ * @union hal_host_regs_t
+ * @brief Página de registros que se comparte con el proceso que simula el hardware
+ */
+typedef union {
+    struct {
+        uint32_t magic;                     /**< HAL_HOST_MAGIC una vez inicializada */
+        volatile int32_t pid;               /**< Proceso al que enviar SIGUSR1 */
+        GPIO_TypeDef gpio[HAL_HOST_PORTS];  /**< Puertos GPIOA a GPIOH */
+    };
+    uint8_t pagina[HAL_HOST_PAGE];
+} hal_host_regs_t;
+
+/* === Public variable declarations ============================================================ */
+/** @brief Registros emulados, alineados a página para poder mapearlos sobre memoria compartida */
+extern hal_host_regs_t hal_host_regs;
+
+/* === Public function declarations ============================================================ */
+/**
+ * @brief Inicializa la HAL emulada
+ * @return HAL_OK, o HAL_ERROR si no se pudo mapear la memoria compartida indicada en
+ * HAL_HOST_SHM
+ * @details Arranca el tick, instala los manejadores de SIGUSR1 y SIGALRM y, si HAL_HOST_SHM está
+ * definida, reemplaza la página de registros por el objeto de memoria compartida
+ */
+HAL_StatusTypeDef HAL_Init(void);
+
+/**
+ * @brief Milisegundos transcurridos desde HAL_Init(), de un reloj monotónico
+ */
+uint32_t HAL_GetTick(void);
+
+/**
+ * @brief Espera activa la cantidad de milisegundos indicada
+ */
+void HAL_Delay(uint32_t delay);
+
+/**
+ * @brief Detiene el SysTick emulado para que __WFI() solo despierte con un flanco
+ */
+void HAL_SuspendTick(void);
+
+/**
+ * @brief Reanuda el SysTick emulado
+ */
+void HAL_ResumeTick(void);
+
+/**
+ * @brief Lee un pin del registro IDR
+ */
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin);
+
+/**
+ * @brief Escribe uno o varios pines del registro ODR de forma atómica
+ */
+void HAL_GPIO_WritePin(GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+
+/**
+ * @brief Invierte uno o varios pines del registro ODR de forma atómica
+ */
+void HAL_GPIO_TogglePin(GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin);
+
+/**
+ * @brief Callback de interrupción por cambio de pin
+ * @param GPIO_Pin Pin que cambió
+ * @note Definición débil, la aplicación la redefine igual que en la HAL de ST
+ */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
+
+/**
+ * @brief Escribe el registro BSRR y aplica a ODR, en un único paso atómico, los pines a poner en
+ * alto (16 bits bajos) y en bajo (16 bits altos)
+ * @note Si un pin aparece en ambas mitades gana el alto, igual que en el hardware
+ */
+void HAL_Host_WriteBSRR(GPIO_TypeDef * GPIOx, uint32_t valor);
+
+/**
+ * @brief Microsegundos transcurridos desde HAL_Init(), con desborde natural a 32 bits
+ * @note Fuente de reloj de API_delay cuando DELAY_TICK_HZ es 1000000
+ */
+uint32_t HAL_Host_GetMicros(void);
+
+/**
+ * @brief Bloquea la entrega de interrupciones emuladas
+ */
+void HAL_Host_DisableIrq(void);
+
+/**
+ * @brief Desbloquea la entrega de interrupciones emuladas
+ */
+void HAL_Host_EnableIrq(void);
+
+/**
+ * @brief Espera la próxima interrupción emulada (flanco o SysTick)
+ * @note Igual que WFI, despierta aunque las interrupciones estén deshabilitadas y el manejador se
+ * ejecuta antes de volver
+ */
+void HAL_Host_WaitForInterrupt(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_HOST_H */
@@ -31,6 +31,11 @@ SPDX-License-Identifier: MIT
  */
 
 /* === Headers files inclusions ================================================================ */
+#if defined(HAL_HOST) || defined(TEST)
+#include "hal_host.h"
+#else
+#include "stm32f4xx_hal.h"
+#endif
 
 /* === Cabecera C++ ============================================================================ */
 
@@ -29,12 +29,31 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions =============================================================== */
 
 #include "API_IO.h"
+#include "API_IO_inline.h"
 #include "main.h"
 
 /* === Macros definitions ====================================================================== */
 
+_Static_assert(IO_DEVICE_COUNT <= 8 * sizeof(IO_Snapshot_t),
+               "IO_Snapshot_t no tiene un bit para cada dispositivo");
+
+/** @brief Máscara con un bit por cada dispositivo existente */
+#define IO_DEVICES_MASK ((IO_Snapshot_t)(((uint64_t)1u << IO_DEVICE_COUNT) - 1u))
+
+/** @brief Genera la entrada de io_mapping de un dispositivo de IO_DEVICE_TABLE */
+#define IO_MAPPING_ENTRY(nombre, puerto, pin) [nombre] = {puerto, pin},
+
 /* === Private data type declarations ========================================================== */
 
+/**
+ * @struct io_port_t
+ * @brief Puerto GPIO con los dispositivos que tiene conectados
+ */
+typedef struct {
+    GPIO_TypeDef * port;
+    IO_Snapshot_t dispositivos; /**< Bits de IO_Snapshot_t que pertenecen al puerto */
+} io_port_t;
+
 /* === Private variable declarations =========================================================== */
 
 /**
@@ -44,20 +63,66 @@ SPDX-License-Identifier: MIT
 static const struct {
     GPIO_TypeDef * port;
     uint16_t pin;
-} io_mapping[IO_DEVICE_COUNT] = {
-    [IO_BUTTON_USER] = {BUTTON_PORT, BUTTON_PIN}, [IO_LED_DEBUG] = {LED_PORT, LED_PIN}};
+} io_mapping[IO_DEVICE_COUNT] = {IO_DEVICE_TABLE(IO_MAPPING_ENTRY)};
+
+/** @brief Puertos distintos referenciados en io_mapping */
+static io_port_t io_ports[IO_DEVICE_COUNT];
+/** @brief Cantidad de entradas válidas en io_ports */
+static uint8_t io_portCount;
+/** @brief Última lectura conocida de cada dispositivo, para io_state.readHook */
+static IO_Snapshot_t io_lastSnapshot;
 
 /* === Private function declarations =========================================================== */
 
+/**
+ * @brief Arma la tabla de puertos a partir de io_mapping
+ */
+static void buildPortTable(void);
+
+/**
+ * @brief Registra en la copia de salidas el estado escrito en varios dispositivos
+ * @param set Dispositivos que quedaron en alto
+ * @param reset Dispositivos que quedaron en bajo
+ */
+static void updateOutputs(IO_Snapshot_t set, IO_Snapshot_t reset);
+
 /* === Public variable definitions ============================================================= */
+io_state_t io_state;
 
 /* === Private variable definitions ============================================================ */
 
 /* === Private function implementation ========================================================= */
+static void buildPortTable(void) {
+    io_portCount = 0;
+
+    for (uint8_t device = 0; device < IO_DEVICE_COUNT; device++) {
+        uint8_t index = 0;
+
+        while (index < io_portCount && io_ports[index].port != io_mapping[device].port) {
+            index++;
+        }
+        if (index == io_portCount) {
+            io_ports[index].port = io_mapping[device].port;
+            io_ports[index].dispositivos = 0;
+            io_portCount++;
+        }
+        io_ports[index].dispositivos |= (IO_Snapshot_t)1u << device;
+    }
+}
+
+static void updateOutputs(IO_Snapshot_t set, IO_Snapshot_t reset) {
+    io_state.outputs = (io_state.outputs & ~reset) | set;
+    io_state.outputsKnown |= set | reset;
+}
 
 /* === Public function implementation ========================================================== */
 void IO_Init(void) {
 
+    buildPortTable();
+    io_state.outputsKnown = 0;
+    io_state.pendingSet = 0;
+    io_state.pendingReset = 0;
+
     /* Estado inicial del LED (apagado) */
     IO_Write(IO_LED_DEBUG, false);
 }
@@ -69,24 +134,119 @@ IO_Status_t IO_Read(IO_Device_t device, bool * state) {
     if (state == NULL)
         return IO_ERROR;
 
-    *state = (HAL_GPIO_ReadPin(io_mapping[device].port, io_mapping[device].pin) == GPIO_PIN_SET);
+    *state = IO_ReadFast(device);
     return IO_OK;
 }
 
+void io_notifyRead(IO_Device_t device, bool state) {
+    io_lastSnapshot = (io_lastSnapshot & ~IO_MASK(device)) | ((IO_Snapshot_t)state << device);
+    io_state.readHook(io_lastSnapshot);
+}
+
+IO_Status_t IO_ReadPort(IO_Device_t device, uint16_t * value) {
+    if (device >= IO_DEVICE_COUNT)
+        return IO_INVALID_DEVICE;
+
+    if (value == NULL)
+        return IO_ERROR;
+
+    *value = (uint16_t)io_mapping[device].port->IDR;
+    return IO_OK;
+}
+
+IO_Status_t IO_ReadMany(IO_Snapshot_t * snapshot) {
+    IO_Snapshot_t resultado = 0;
+
+    if (snapshot == NULL || io_portCount == 0)
+        return IO_ERROR;
+
+    for (uint8_t index = 0; index < io_portCount; index++) {
+        /* Un único acceso al registro de entrada por puerto */
+        uint16_t valor = (uint16_t)io_ports[index].port->IDR;
+        IO_Snapshot_t pendientes = io_ports[index].dispositivos;
+
+        while (pendientes != 0) {
+            uint8_t device = (uint8_t)__builtin_ctz(pendientes);
+
+            pendientes &= pendientes - 1;
+            if (valor & io_mapping[device].pin) {
+                resultado |= (IO_Snapshot_t)1u << device;
+            }
+        }
+    }
+
+    *snapshot = resultado;
+
+    if (io_state.readHook != NULL) {
+        io_lastSnapshot = resultado;
+        io_state.readHook(resultado);
+    }
+    return IO_OK;
+}
+
+void IO_SetReadHook(IO_ReadHook_t hook) {
+    io_state.readHook = hook;
+}
+
 IO_Status_t IO_Write(IO_Device_t device, bool state) {
     if (device >= IO_DEVICE_COUNT)
         return IO_INVALID_DEVICE;
 
-    HAL_GPIO_WritePin(io_mapping[device].port, io_mapping[device].pin,
-                      state ? GPIO_PIN_SET : GPIO_PIN_RESET);
+    IO_WriteFast(device, state);
+    return IO_OK;
+}
+
+IO_Status_t IO_WriteMask(IO_Snapshot_t set, IO_Snapshot_t reset) {
+    if ((set | reset) & ~IO_DEVICES_MASK)
+        return IO_INVALID_DEVICE;
+
+    if (set & reset)
+        return IO_ERROR;
+
+    io_state.pendingSet = (io_state.pendingSet & ~reset) | set;
+    io_state.pendingReset = (io_state.pendingReset & ~set) | reset;
     return IO_OK;
 }
 
+uint8_t IO_Flush(void) {
+    uint8_t escritos = 0;
+    /* Solo los pines cuyo estado conocido difiere del pedido */
+    IO_Snapshot_t set = io_state.pendingSet & ~(io_state.outputs & io_state.outputsKnown);
+    IO_Snapshot_t reset = io_state.pendingReset & (io_state.outputs | ~io_state.outputsKnown);
+
+    io_state.pendingSet = 0;
+    io_state.pendingReset = 0;
+
+    for (uint8_t index = 0; index < io_portCount && (set | reset) != 0; index++) {
+        IO_Snapshot_t pendientes = (set | reset) & io_ports[index].dispositivos;
+        uint32_t valor = 0;
+
+        while (pendientes != 0) {
+            uint8_t device = (uint8_t)__builtin_ctz(pendientes);
+
+            pendientes &= pendientes - 1;
+            if (set & IO_MASK(device)) {
+                valor |= io_mapping[device].pin;
+            } else {
+                valor |= (uint32_t)io_mapping[device].pin << 16;
+            }
+        }
+
+        if (valor != 0) {
+            GPIO_WRITE_BSRR(io_ports[index].port, valor);
+            escritos++;
+        }
+    }
+
+    updateOutputs(set, reset);
+    return escritos;
+}
+
 IO_Status_t IO_Toggle(IO_Device_t device) {
     if (device >= IO_DEVICE_COUNT)
         return IO_INVALID_DEVICE;
 
-    HAL_GPIO_TogglePin(io_mapping[device].port, io_mapping[device].pin);
+    IO_ToggleFast(device);
     return IO_OK;
 }
 
@@ -29,128 +29,1003 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions =============================================================== */
 
 #include "API_debounce.h"
+#include <stddef.h>
+
+#if DEBOUNCE_IO_INLINE
+#include "API_IO_inline.h"
+#endif
+
+#ifdef DEBOUNCE_HANDLERS_HEADER
+#include DEBOUNCE_HANDLERS_HEADER
+#endif
+
+#if DEBOUNCE_WAIT_FUTEX
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#else
+#include "main.h"
+#endif
 
 /* === Macros definitions ====================================================================== */
 
+#if DEBOUNCE_IO_INLINE
+/** @brief Lee la entrada de una instancia sin llamadas fuera de línea */
+#define LEER_DISPOSITIVO(device, estado) (*(estado) = IO_ReadFast(device))
+/** @brief Escribe el LED de debug sin llamadas fuera de línea */
+#define ESCRIBIR_LED(estado) IO_LED_DEBUG_Write(estado)
+#else
+/** @brief Lee la entrada de una instancia a través de la API validada */
+#define LEER_DISPOSITIVO(device, estado) IO_Read((device), (estado))
+/** @brief Escribe el LED de debug a través de la API validada */
+#define ESCRIBIR_LED(estado) IO_Write(IO_LED_DEBUG, (estado))
+#endif
+
+/** @brief Acción: iniciar el retardo de antirrebote */
+#define FSM_TIMER 0x04u
+/** @brief Acción: confirmar una presión, igual a EVENT_PRESSED */
+#define FSM_PRESSED ((uint8_t)EVENT_PRESSED)
+/** @brief Acción: confirmar una liberación, igual a EVENT_RELEASED */
+#define FSM_RELEASED ((uint8_t)EVENT_RELEASED)
+/** @brief Bits de la acción que forman el evento a publicar */
+#define FSM_EVENTO 0x03u
+
+/** @brief Manejadores enlazados en tiempo de compilación en lugar de la tabla de suscriptores */
+#if defined(DEBOUNCE_ON_PRESS) && defined(DEBOUNCE_ON_RELEASE)
+#define DEBOUNCE_DESPACHO_DIRECTO 1
+#else
+#define DEBOUNCE_DESPACHO_DIRECTO 0
+#endif
+
+/** @brief Cantidad de estados de la FSM */
+#define FSM_ESTADOS (BUTTON_RISING + 1)
+
+/**
+ * @brief Especificación de la FSM de antirrebote: X(estado, entrada, vencido, siguiente, acciones)
+ * @details Cada fila es una transición para un estado, el nivel leído y si venció el retardo.
+ * Las combinaciones que no figuran mantienen el estado sin acciones. Un estado que tiene alguna
+ * fila con vencido = 1 es temporizado: solo lee la entrada cuando vence el retardo. Los demás
+ * leen en cada actualización (o al notificarse un flanco en modo interrupción).
+ */
+#define DEBOUNCE_FSM_SPEC(X)                                                                     \
+    X(BUTTON_UP, 1, 0, BUTTON_FALLING, FSM_TIMER)                                                \
+    X(BUTTON_FALLING, 0, 1, BUTTON_UP, 0)                                                        \
+    X(BUTTON_FALLING, 1, 1, BUTTON_DOWN, FSM_PRESSED)                                            \
+    X(BUTTON_DOWN, 0, 0, BUTTON_RISING, FSM_TIMER)                                               \
+    X(BUTTON_RISING, 1, 1, BUTTON_DOWN, 0)                                                       \
+    X(BUTTON_RISING, 0, 1, BUTTON_UP, FSM_RELEASED)
+
+/** @brief Genera una entrada de la tabla de transiciones a partir de una fila de la especificación */
+#define FSM_TRANSICION(est, ent, venc, sig, acc) [est][ent][venc] = {(est) ^ (sig), (acc)},
+
+/** @brief Agrega el bit del estado a la máscara de estados temporizados si la fila usa el retardo */
+#define FSM_TEMPORIZADO(est, ent, venc, sig, acc) | ((venc) ? (1u << (est)) : 0u)
+
 /* === Private data type declarations ========================================================== */
-/* === Public variable definitions ============================================================= */
-
-/** @brief Estados internos de la FSM */
-typedef enum {
-    BUTTON_UP,
-    BUTTON_FALLING,
-    BUTTON_DOWN,
-    BUTTON_RISING,
-} debounceState_t;
+
+/** @brief Historia con todas las muestras del registro de desplazamiento activas */
+#define SHIFT_MASCARA ((uint16_t)((1ul << DEBOUNCE_SHIFT_BITS) - 1u))
+
+_Static_assert(DEBOUNCE_SHIFT_BITS >= 2 && DEBOUNCE_SHIFT_BITS <= 16,
+               "DEBOUNCE_SHIFT_BITS debe estar entre 2 y 16");
+_Static_assert(DEBOUNCE_INTEGRADOR_MAX >= 1 && DEBOUNCE_INTEGRADOR_MAX <= UINT8_MAX,
+               "DEBOUNCE_INTEGRADOR_MAX debe entrar en un uint8_t");
+
+/**
+ * @struct algoritmo_t
+ * @brief Operaciones de un algoritmo de antirrebote
+ */
+typedef struct {
+    void (*iniciar)(debounce_t * debounce); /**< Deja el estado propio en reposo */
+    eventEdge_t (*paso)(debounce_t * debounce, const IO_Snapshot_t * snapshot,
+                        tick_t now);        /**< Procesa una actualización */
+    uint8_t tamanioEstado;                  /**< Bytes de estado propio en debounce_t */
+} algoritmo_t;
+
+/**
+ * @struct transicion_t
+ * @brief Entrada de la tabla de transiciones
+ * @details El siguiente estado se guarda como XOR con el actual, así las combinaciones que no
+ * figuran en la especificación quedan en cero y mantienen el estado sin una rama extra.
+ */
+typedef struct {
+    uint8_t cambio;   /**< Estado actual XOR siguiente estado */
+    uint8_t acciones; /**< Combinación de FSM_TIMER, FSM_PRESSED y FSM_RELEASED */
+} transicion_t;
+
+/**
+ * @struct suscriptor_t
+ * @brief Entrada de la tabla de suscriptores
+ */
+typedef struct {
+    const debounce_t * instancia; /**< Instancia dueña de la entrada, NULL si está libre */
+    debounceHandler_t onPress;    /**< Manejador de las presiones */
+    debounceHandler_t onRelease;  /**< Manejador de las liberaciones */
+    void * contexto;              /**< Puntero que se entrega a los manejadores */
+} suscriptor_t;
+
+_Static_assert(DEBOUNCE_MAX_SUSCRIPTORES >= 1 && DEBOUNCE_MAX_SUSCRIPTORES < UINT8_MAX,
+               "DEBOUNCE_MAX_SUSCRIPTORES debe estar entre 1 y 254");
+
 /* === Private variable declarations =========================================================== */
 
-/** @brief  Estado actual de la FSM  */
-static debounceState_t estadoActual;
-/** @brief  Temporizador para antirrebote  */
-static delay_t tiempoRetardo;
-/** @brief  Flag de evento de presión  */
-static bool_t keyButtonDesc;
-/** @brief  Flag de evento de liberación  */
-static bool_t keyButtonAsc;
+/** @brief  Instancia por defecto usada por las funciones debounceFSM_*  */
+static debounce_t botonUsuario;
+/** @brief  Instancias registradas para debounce_UpdateAll()  */
+static debounce_t * registro[GPIO_MAX_INSTANCES];
+/** @brief  Cantidad de instancias registradas  */
+static uint8_t cantidadRegistradas;
+/** @brief  Eventos confirmados por todas las instancias  */
+static eventQueue_t colaEventos;
+/** @brief  Manejadores suscriptos, cada instancia guarda la posición de su entrada  */
+static suscriptor_t suscriptores[DEBOUNCE_MAX_SUSCRIPTORES];
+/** @brief  Dispositivos con eventos que todavía no informó debounce_WaitEvent()  */
+static atomic_uint avisos;
+#if DEBOUNCE_WAIT_FUTEX
+/** @brief  Hilos bloqueados en debounce_WaitEvent(), evita la llamada al sistema sin esperas  */
+static atomic_uint esperando;
+#endif
+
+/** @brief  Tabla de transiciones indexada por [estado][entrada][vencido], en memoria constante  */
+static const transicion_t tablaTransiciones[FSM_ESTADOS][2][2] = {
+    DEBOUNCE_FSM_SPEC(FSM_TRANSICION)};
+/** @brief  Máscara con un bit por cada estado que espera el vencimiento del retardo  */
+static const uint8_t estadosTemporizados = 0u DEBOUNCE_FSM_SPEC(FSM_TEMPORIZADO);
 
 /* === Private function declarations =========================================================== */
 
+/**
+ * @brief Obtiene el nivel actual de la entrada de una instancia
+ * @param debounce Instancia a consultar
+ * @param snapshot Lectura previa de IO_ReadMany(), o NULL para leer el dispositivo con IO_Read()
+ * @return true si la entrada está activa
+ */
+static bool leerEntrada(const debounce_t * debounce, const IO_Snapshot_t * snapshot);
+
+/**
+ * @brief Indica si en un estado estable hay que leer la entrada
+ * @param debounce Instancia a consultar
+ * @return true en modo polling o si hay un flanco notificado, que se consume
+ */
+static bool hayQueLeer(debounce_t * debounce);
+
+/**
+ * @brief Ejecuta una actualización con el algoritmo de la instancia
+ * @param debounce Instancia a actualizar
+ * @param snapshot Lectura previa de IO_ReadMany(), o NULL para leer el dispositivo con IO_Read()
+ * @param now Tick actual
+ * @return Flanco confirmado en este paso, o EVENT_NONE
+ */
+static eventEdge_t debounceStep(debounce_t * debounce, const IO_Snapshot_t * snapshot,
+                                tick_t now);
+
+/**
+ * @brief Ejecuta una transición de la FSM temporizada a partir de la tabla de transiciones
+ * @param debounce Instancia a actualizar
+ * @param snapshot Lectura previa de IO_ReadMany(), o NULL para leer el dispositivo con IO_Read()
+ * @param now Tick actual
+ * @return Flanco confirmado en este paso, o EVENT_NONE
+ */
+static eventEdge_t pasoTemporizado(debounce_t * debounce, const IO_Snapshot_t * snapshot,
+                                   tick_t now);
+
+/**
+ * @brief Actualiza el integrador saturado de una instancia
+ * @param debounce Instancia a actualizar
+ * @param snapshot Lectura previa de IO_ReadMany(), o NULL para leer el dispositivo con IO_Read()
+ * @param now No se usa
+ * @return Flanco confirmado en este paso, o EVENT_NONE
+ */
+static eventEdge_t pasoIntegrador(debounce_t * debounce, const IO_Snapshot_t * snapshot,
+                                  tick_t now);
+
+/**
+ * @brief Actualiza el registro de desplazamiento de una instancia
+ * @param debounce Instancia a actualizar
+ * @param snapshot Lectura previa de IO_ReadMany(), o NULL para leer el dispositivo con IO_Read()
+ * @param now No se usa
+ * @return Flanco confirmado en este paso, o EVENT_NONE
+ */
+static eventEdge_t pasoRegistro(debounce_t * debounce, const IO_Snapshot_t * snapshot,
+                                tick_t now);
+
+/**
+ * @brief Actualiza una instancia con el algoritmo de ventana adaptativa
+ * @param debounce Instancia a actualizar
+ * @param snapshot Lectura previa de IO_ReadMany(), o NULL para leer el dispositivo con IO_Read()
+ * @param now Tick actual
+ * @return Flanco confirmado en este paso, o EVENT_NONE
+ */
+static eventEdge_t pasoAdaptativo(debounce_t * debounce, const IO_Snapshot_t * snapshot,
+                                  tick_t now);
+
+/**
+ * @brief Actualiza una instancia con el algoritmo anticipado
+ * @param debounce Instancia a actualizar
+ * @param snapshot Lectura previa de IO_ReadMany(), o NULL para leer el dispositivo con IO_Read()
+ * @param now Tick actual
+ * @return Flanco informado en este paso, o EVENT_NONE
+ */
+static eventEdge_t pasoAnticipado(debounce_t * debounce, const IO_Snapshot_t * snapshot,
+                                  tick_t now);
+
+/**
+ * @brief Incorpora un rebote observado a la estimación y recalcula la ventana
+ * @param adaptativo Estado del algoritmo adaptativo
+ * @param rebote Ticks entre el primer flanco y el último cambio observado
+ */
+static void aprenderRebote(debounceAdaptive_t * adaptativo, tick_t rebote);
+
+/**
+ * @brief Actualiza el estado de un algoritmo por conteo de muestras
+ * @param debounce Instancia a actualizar
+ * @param todoActivo El algoritmo confirma la entrada activa
+ * @param todoInactivo El algoritmo confirma la entrada inactiva
+ * @return Flanco confirmado, o EVENT_NONE
+ */
+static eventEdge_t resolverConteo(debounce_t * debounce, bool todoActivo, bool todoInactivo);
+
+#if DEBOUNCE_STATS
+/**
+ * @brief Actualiza las estadísticas de una instancia después de una transición
+ * @param debounce Instancia actualizada
+ * @param anterior Estado antes de la transición
+ * @param evento Flanco confirmado en la transición
+ * @param now Tick de la transición
+ */
+static void registrarEstadisticas(debounce_t * debounce, debounceState_t anterior,
+                                  eventEdge_t evento, tick_t now);
+#endif
+
+/** @brief Prepara el retardo de DEBOUNCE_ALG_TIMER */
+static void iniciarTemporizado(debounce_t * debounce);
+/** @brief Vacía el integrador de DEBOUNCE_ALG_INTEGRATOR */
+static void iniciarIntegrador(debounce_t * debounce);
+/** @brief Vacía la historia de DEBOUNCE_ALG_SHIFT */
+static void iniciarRegistro(debounce_t * debounce);
+/** @brief Carga la ventana inicial y los límites por defecto de DEBOUNCE_ALG_ADAPTIVE */
+static void iniciarAdaptativo(debounce_t * debounce);
+/** @brief Prepara el bloqueo y el filtro de ruido de DEBOUNCE_ALG_EAGER */
+static void iniciarAnticipado(debounce_t * debounce);
+
+/**
+ * @brief Entrega un evento confirmado a los manejadores de la instancia
+ * @param debounce Instancia que confirmó el evento
+ * @param event Evento ya encolado
+ */
+static void despacharEvento(const debounce_t * debounce, const event_t * event);
+
+/**
+ * @brief Marca el dispositivo como avisado y despierta a los hilos en debounce_WaitEvent()
+ * @param device Dispositivo que confirmó un evento
+ */
+static void avisarEvento(IO_Device_t device);
+
+/**
+ * @brief Devuelve y borra los avisos de las entradas indicadas
+ * @param entradas Máscara de dispositivos
+ * @return Entradas de la máscara que tenían aviso
+ */
+static IO_Snapshot_t tomarAvisos(IO_Snapshot_t entradas);
+
+/**
+ * @brief Encola el evento confirmado por la FSM con su marca de tiempo y lo despacha
+ * @param debounce Instancia actualizada
+ * @param evento Flanco devuelto por debounceStep()
+ * @param now Tick en el que se confirmó el evento
+ */
+static void publicarEvento(const debounce_t * debounce, eventEdge_t evento, tick_t now);
+
+/**
+ * @brief Registra en la instancia el evento confirmado por la FSM
+ * @param debounce Instancia actualizada
+ * @param evento Flanco devuelto por debounceStep()
+ * @param now Tick en el que se confirmó el evento
+ */
+static void guardarEvento(debounce_t * debounce, eventEdge_t evento, tick_t now);
+
 /* === Private variable definitions ============================================================ */
 
+/** @brief Operaciones de cada algoritmo, indexadas por debounceAlgorithm_t */
+static const algoritmo_t algoritmos[DEBOUNCE_ALG_COUNT] = {
+    [DEBOUNCE_ALG_TIMER] = {iniciarTemporizado, pasoTemporizado, sizeof(delay_t)},
+    [DEBOUNCE_ALG_INTEGRATOR] = {iniciarIntegrador, pasoIntegrador, sizeof(uint8_t)},
+    [DEBOUNCE_ALG_SHIFT] = {iniciarRegistro, pasoRegistro, sizeof(uint16_t)},
+    [DEBOUNCE_ALG_ADAPTIVE] = {iniciarAdaptativo, pasoAdaptativo, sizeof(debounceAdaptive_t)},
+    [DEBOUNCE_ALG_EAGER] = {iniciarAnticipado, pasoAnticipado, sizeof(debounceEager_t)},
+};
+
 /* === Private function implementation ========================================================= */
 
-/* === Public function implementation ========================================================== */
+static bool leerEntrada(const debounce_t * debounce, const IO_Snapshot_t * snapshot) {
+    bool buttonState;
 
-/*Se inicializa la FEM indicando el estado inicial e inicializando el delay*/
-void debounceFSM_Init() {
-    delayInit(&tiempoRetardo, TIEMPO_RETARDO);
-    estadoActual = BUTTON_UP;
-    IO_Write(IO_LED_DEBUG, false);
+    if (snapshot != NULL) {
+        return IO_SNAPSHOT_STATE(*snapshot, debounce->device);
+    }
+    LEER_DISPOSITIVO(debounce->device, &buttonState);
+    return buttonState;
 }
 
-/*Contiene la trancisicion de estados en base al gráfico de transicion de estados*/
-void debounceFSM_Update() {
+static bool hayQueLeer(debounce_t * debounce) {
+    if (debounce->modo == DEBOUNCE_MODE_POLLING) {
+        return true;
+    }
+    /* Se limpia antes de leer para no perder un flanco que llegue durante la lectura */
+    return atomic_exchange(&debounce->flanco, false);
+}
 
-    bool buttonState;
+static eventEdge_t debounceStep(debounce_t * debounce, const IO_Snapshot_t * snapshot,
+                                tick_t now) {
+#if DEBOUNCE_STATS
+    debounceState_t anterior = debounce->estado;
+    eventEdge_t evento = algoritmos[debounce->algoritmo].paso(debounce, snapshot, now);
+
+    registrarEstadisticas(debounce, anterior, evento, now);
+    return evento;
+#else
+    return algoritmos[debounce->algoritmo].paso(debounce, snapshot, now);
+#endif
+}
+
+#if DEBOUNCE_STATS
+static void registrarEstadisticas(debounce_t * debounce, debounceState_t anterior,
+                                  eventEdge_t evento, tick_t now) {
+    debounceStats_t * stats = &debounce->stats;
+    bool estableAntes = (anterior == BUTTON_UP || anterior == BUTTON_DOWN);
+    tick_t latencia;
+    uint32_t intervalo;
+
+    if (anterior == debounce->estado && evento == EVENT_NONE) {
+        return;
+    }
+    if (estableAntes) {
+        stats->primerFlanco = now;
+    } else if (anterior == BUTTON_FALLING && debounce->estado == BUTTON_UP) {
+        stats->abortosPresion++;
+    } else if (anterior == BUTTON_RISING && debounce->estado == BUTTON_DOWN) {
+        stats->abortosLiberacion++;
+    }
+    if (evento == EVENT_NONE) {
+        return;
+    }
+
+    latencia = now - stats->primerFlanco;
+    if (stats->eventos == 0 || latencia < stats->latenciaMinima) {
+        stats->latenciaMinima = latencia;
+    }
+    if (stats->eventos == 0 || latencia > stats->latenciaMaxima) {
+        stats->latenciaMaxima = latencia;
+    }
+    intervalo = latencia / DEBOUNCE_STATS_BIN_TICKS;
+    if (intervalo >= DEBOUNCE_STATS_BINS) {
+        intervalo = DEBOUNCE_STATS_BINS - 1;
+    }
+    stats->histograma[intervalo]++;
+    stats->eventos++;
+    stats->ultimoEvento = now;
+}
+#endif
+
+/*Aplica la transición de la tabla según el estado, la entrada y el vencimiento del retardo*/
+static eventEdge_t pasoTemporizado(debounce_t * debounce, const IO_Snapshot_t * snapshot,
+                                   tick_t now) {
+    const transicion_t * transicion;
+    uint8_t estado = (uint8_t)debounce->estado;
+    bool vencido = false;
+
+    if (estado >= FSM_ESTADOS) {
+        debounce->estado = BUTTON_UP;
+        return EVENT_NONE;
+    }
 
-    switch (estadoActual) {
-    case BUTTON_UP:
-        IO_Read(IO_BUTTON_USER, &buttonState);
-        if (buttonState) {
-            estadoActual = BUTTON_FALLING;
-            delayRead(&tiempoRetardo);
+    /* Solo se lee la entrada cuando la transición puede depender de ella */
+    if (estadosTemporizados & (1u << estado)) {
+        vencido = delayReadAt(&debounce->retardo, now);
+        if (!vencido) {
+            return EVENT_NONE;
         }
-        break;
+    } else if (!hayQueLeer(debounce)) {
+        return EVENT_NONE;
+    }
 
-    case BUTTON_FALLING:
-        if (delayRead(&tiempoRetardo)) {
+    transicion = &tablaTransiciones[estado][leerEntrada(debounce, snapshot)][vencido];
+    debounce->estado = (debounceState_t)(estado ^ transicion->cambio);
+    if (transicion->acciones & FSM_TIMER) {
+        delayReadAt(&debounce->retardo, now);
+    }
+    return (eventEdge_t)(transicion->acciones & FSM_EVENTO);
+}
 
-            IO_Read(IO_BUTTON_USER, &buttonState);
+static eventEdge_t resolverConteo(debounce_t * debounce, bool todoActivo, bool todoInactivo) {
+    if (debounce->estado == BUTTON_UP || debounce->estado == BUTTON_FALLING) {
+        if (todoActivo) {
+            debounce->estado = BUTTON_DOWN;
+            return EVENT_PRESSED;
+        }
+        debounce->estado = todoInactivo ? BUTTON_UP : BUTTON_FALLING;
+    } else {
+        if (todoInactivo) {
+            debounce->estado = BUTTON_UP;
+            return EVENT_RELEASED;
+        }
+        debounce->estado = todoActivo ? BUTTON_DOWN : BUTTON_RISING;
+    }
+    return EVENT_NONE;
+}
 
-            if (!buttonState) {
-                estadoActual = BUTTON_UP;
-            }
+static eventEdge_t pasoIntegrador(debounce_t * debounce, const IO_Snapshot_t * snapshot,
+                                  tick_t now) {
+    (void)now;
 
-            else {
-                button_Pressed();
-                estadoActual = BUTTON_DOWN;
-            }
+    /* Con la entrada estable en modo interrupción no hay nada que integrar */
+    if ((debounce->estado == BUTTON_UP || debounce->estado == BUTTON_DOWN) &&
+        !hayQueLeer(debounce)) {
+        return EVENT_NONE;
+    }
+    if (leerEntrada(debounce, snapshot)) {
+        if (debounce->integrador < DEBOUNCE_INTEGRADOR_MAX) {
+            debounce->integrador++;
         }
+    } else if (debounce->integrador > 0) {
+        debounce->integrador--;
+    }
+    return resolverConteo(debounce, debounce->integrador == DEBOUNCE_INTEGRADOR_MAX,
+                          debounce->integrador == 0);
+}
 
-        break;
+static eventEdge_t pasoRegistro(debounce_t * debounce, const IO_Snapshot_t * snapshot,
+                                tick_t now) {
+    (void)now;
+
+    if ((debounce->estado == BUTTON_UP || debounce->estado == BUTTON_DOWN) &&
+        !hayQueLeer(debounce)) {
+        return EVENT_NONE;
+    }
+    debounce->historia =
+        (uint16_t)((debounce->historia << 1) | leerEntrada(debounce, snapshot)) & SHIFT_MASCARA;
+    return resolverConteo(debounce, debounce->historia == SHIFT_MASCARA, debounce->historia == 0);
+}
 
-    case BUTTON_DOWN:
-        IO_Read(IO_BUTTON_USER, &buttonState);
-        if (!buttonState) {
-            estadoActual = BUTTON_RISING;
-            delayRead(&tiempoRetardo);
+static eventEdge_t pasoAdaptativo(debounce_t * debounce, const IO_Snapshot_t * snapshot,
+                                  tick_t now) {
+    debounceAdaptive_t * adaptativo = &debounce->adaptativo;
+    bool presionado = (debounce->estado == BUTTON_DOWN || debounce->estado == BUTTON_FALLING);
+    bool entrada;
+
+    if (debounce->estado == BUTTON_UP || debounce->estado == BUTTON_DOWN) {
+        if (!hayQueLeer(debounce)) {
+            return EVENT_NONE;
         }
-        break;
+        entrada = leerEntrada(debounce, snapshot);
+        if (entrada != presionado) {
+            debounce->estado = entrada ? BUTTON_FALLING : BUTTON_RISING;
+            adaptativo->inicio = now;
+            adaptativo->ultimoCambio = now;
+            adaptativo->nivel = entrada;
+        }
+        return EVENT_NONE;
+    }
 
-    case BUTTON_RISING:
-        if (delayRead(&tiempoRetardo)) {
+    /* Durante el antirrebote se muestrea siempre para medir cuánto rebota la entrada */
+    entrada = leerEntrada(debounce, snapshot);
+    if (entrada != adaptativo->nivel) {
+        adaptativo->nivel = entrada;
+        adaptativo->ultimoCambio = now;
+    }
+    if ((tick_t)(now - adaptativo->inicio) < adaptativo->ventana) {
+        return EVENT_NONE;
+    }
+    aprenderRebote(adaptativo, adaptativo->ultimoCambio - adaptativo->inicio);
 
-            IO_Read(IO_BUTTON_USER, &buttonState);
+    if (entrada == presionado) {
+        debounce->estado = presionado ? BUTTON_DOWN : BUTTON_UP;
+        return presionado ? EVENT_PRESSED : EVENT_RELEASED;
+    }
+    debounce->estado = presionado ? BUTTON_UP : BUTTON_DOWN;
+    return EVENT_NONE;
+}
 
-            if (buttonState) {
-                estadoActual = BUTTON_DOWN;
+static eventEdge_t pasoAnticipado(debounce_t * debounce, const IO_Snapshot_t * snapshot,
+                                  tick_t now) {
+    debounceEager_t * anticipado = &debounce->anticipado;
+    bool presionado;
 
-            } else {
-                button_Released();
-                estadoActual = BUTTON_UP;
-            }
+    if (debounce->estado == BUTTON_FALLING || debounce->estado == BUTTON_RISING) {
+        /* Bloqueo posterior al evento: no se lee la entrada hasta que vence el retardo */
+        if (delayReadAt(&anticipado->bloqueo, now)) {
+            debounce->estado = (debounce->estado == BUTTON_FALLING) ? BUTTON_DOWN : BUTTON_UP;
         }
+        return EVENT_NONE;
+    }
+    if (!hayQueLeer(debounce)) {
+        return EVENT_NONE;
+    }
+
+    presionado = (debounce->estado == BUTTON_DOWN);
+    if (leerEntrada(debounce, snapshot) == presionado) {
+        anticipado->coincidencias = 0;
+        return EVENT_NONE;
+    }
+    if (++anticipado->coincidencias < anticipado->muestras) {
+        /* Faltan muestras: en modo interrupción se sigue leyendo en la próxima actualización */
+        atomic_store(&debounce->flanco, true);
+        return EVENT_NONE;
+    }
+
+    anticipado->coincidencias = 0;
+    delayReadAt(&anticipado->bloqueo, now);
+    debounce->estado = presionado ? BUTTON_RISING : BUTTON_FALLING;
+    return presionado ? EVENT_RELEASED : EVENT_PRESSED;
+}
+
+static void aprenderRebote(debounceAdaptive_t * adaptativo, tick_t rebote) {
+    uint32_t observado = (rebote < UINT32_MAX / 32u) ? rebote * 16u : UINT32_MAX / 2u;
+    tick_t objetivo;
+
+    if (observado >= adaptativo->estimado) {
+        adaptativo->estimado = observado;
+    } else {
+        adaptativo->estimado -= (adaptativo->estimado - observado) / 8u;
+    }
+
+    objetivo = (adaptativo->estimado + 15u) / 16u + DEBOUNCE_ADAPT_MARGEN;
+    if (objetivo < adaptativo->minimo) {
+        objetivo = adaptativo->minimo;
+    } else if (objetivo > adaptativo->maximo) {
+        objetivo = adaptativo->maximo;
+    }
+    if (objetivo > adaptativo->ventana ||
+        adaptativo->ventana - objetivo >= DEBOUNCE_ADAPT_HISTERESIS) {
+        adaptativo->ventana = objetivo;
+    }
+}
+
+static void iniciarTemporizado(debounce_t * debounce) {
+    delayInit(&debounce->retardo, DELAY_MS(TIEMPO_RETARDO));
+}
+
+static void iniciarIntegrador(debounce_t * debounce) {
+    debounce->integrador = 0;
+}
 
+static void iniciarRegistro(debounce_t * debounce) {
+    debounce->historia = 0;
+}
+
+static void iniciarAdaptativo(debounce_t * debounce) {
+    debounceAdaptive_t * adaptativo = &debounce->adaptativo;
+
+    adaptativo->minimo = DEBOUNCE_ADAPT_MIN;
+    adaptativo->maximo = DEBOUNCE_ADAPT_MAX;
+    adaptativo->ventana = DELAY_MS(TIEMPO_RETARDO);
+    if (adaptativo->ventana < adaptativo->minimo) {
+        adaptativo->ventana = adaptativo->minimo;
+    } else if (adaptativo->ventana > adaptativo->maximo) {
+        adaptativo->ventana = adaptativo->maximo;
+    }
+    /* Se parte de suponer que el rebote ocupa la ventana inicial menos el margen */
+    adaptativo->estimado = (adaptativo->ventana > DEBOUNCE_ADAPT_MARGEN)
+                               ? (adaptativo->ventana - DEBOUNCE_ADAPT_MARGEN) * 16u
+                               : 0;
+    adaptativo->inicio = 0;
+    adaptativo->ultimoCambio = 0;
+    adaptativo->nivel = false;
+}
+
+static void iniciarAnticipado(debounce_t * debounce) {
+    delayInit(&debounce->anticipado.bloqueo, DELAY_MS(TIEMPO_RETARDO));
+    debounce->anticipado.muestras = DEBOUNCE_EAGER_MUESTRAS;
+    debounce->anticipado.coincidencias = 0;
+}
+
+static void despacharEvento(const debounce_t * debounce, const event_t * event) {
+#if DEBOUNCE_DESPACHO_DIRECTO
+    if (event->edge == EVENT_PRESSED) {
+        DEBOUNCE_ON_PRESS(debounce, event);
+    } else {
+        DEBOUNCE_ON_RELEASE(debounce, event);
+    }
+#else
+    const suscriptor_t * suscriptor;
+    debounceHandler_t manejador;
+
+    if (debounce->suscriptor == 0) {
+        return;
+    }
+    suscriptor = &suscriptores[debounce->suscriptor - 1u];
+    manejador = event->edge == EVENT_PRESSED ? suscriptor->onPress : suscriptor->onRelease;
+    if (manejador != NULL) {
+        manejador(event, suscriptor->contexto);
+    }
+#endif
+}
+
+static void avisarEvento(IO_Device_t device) {
+    atomic_fetch_or(&avisos, (unsigned int)IO_MASK(device));
+#if DEBOUNCE_WAIT_FUTEX
+    /* El aviso se publica antes de consultar las esperas y la espera se anota antes de leer los
+       avisos: con orden secuencial alguno de los dos ve al otro y no se pierde el despertar */
+    if (atomic_load(&esperando) > 0) {
+        syscall(SYS_futex, &avisos, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+    }
+#endif
+}
+
+static IO_Snapshot_t tomarAvisos(IO_Snapshot_t entradas) {
+    return (IO_Snapshot_t)atomic_fetch_and(&avisos, ~(unsigned int)entradas) & entradas;
+}
+
+static void publicarEvento(const debounce_t * debounce, eventEdge_t evento, tick_t now) {
+    event_t event;
+
+    if (evento == EVENT_NONE) {
+        return;
+    }
+    event.device = (uint16_t)debounce->device;
+    event.edge = (uint8_t)evento;
+    event.tick = now;
+    eventQueue_Push(&colaEventos, &event);
+    despacharEvento(debounce, &event);
+    avisarEvento(debounce->device);
+}
+
+static void guardarEvento(debounce_t * debounce, eventEdge_t evento, tick_t now) {
+    /* Las banderas se activan antes de publicar: quien despierta por el aviso ya puede leerlas */
+    switch (evento) {
+    case EVENT_PRESSED:
+        debounce->keyDesc = true;
+        break;
+    case EVENT_RELEASED:
+        debounce->keyAsc = true;
         break;
+    default:
+        break;
+    }
+
+    publicarEvento(debounce, evento, now);
+}
+
+/* === Public function implementation ========================================================== */
+
+void debounce_Init(debounce_t * debounce, IO_Device_t device) {
+    debounce_InitWith(debounce, device, DEBOUNCE_ALGORITMO);
+}
+
+bool_t debounce_InitWith(debounce_t * debounce, IO_Device_t device,
+                         debounceAlgorithm_t algoritmo) {
+    if (algoritmo >= DEBOUNCE_ALG_COUNT) {
+        return false;
+    }
+    debounce->algoritmo = (uint8_t)algoritmo;
+    algoritmos[algoritmo].iniciar(debounce);
+    debounce->device = device;
+    debounce->estado = BUTTON_UP;
+    debounce->keyDesc = false;
+    debounce->keyAsc = false;
+    debounce->modo = DEBOUNCE_MODE_POLLING;
+    atomic_init(&debounce->flanco, false);
+    debounce_Unsubscribe(debounce);
+    debounce_ResetStats(debounce);
+    return true;
+}
+
+bool_t debounce_SetAdaptiveBounds(debounce_t * debounce, tick_t minimo, tick_t maximo) {
+    debounceAdaptive_t * adaptativo = &debounce->adaptativo;
 
+    if (debounce->algoritmo != DEBOUNCE_ALG_ADAPTIVE || minimo == 0 || minimo > maximo) {
+        return false;
+    }
+    adaptativo->minimo = minimo;
+    adaptativo->maximo = maximo;
+    if (adaptativo->ventana < minimo) {
+        adaptativo->ventana = minimo;
+    } else if (adaptativo->ventana > maximo) {
+        adaptativo->ventana = maximo;
+    }
+    return true;
+}
+
+bool_t debounce_SetEagerSamples(debounce_t * debounce, uint8_t muestras) {
+    if (debounce->algoritmo != DEBOUNCE_ALG_EAGER || muestras == 0) {
+        return false;
+    }
+    debounce->anticipado.muestras = muestras;
+    debounce->anticipado.coincidencias = 0;
+    return true;
+}
+
+tick_t debounce_GetWindow(const debounce_t * debounce) {
+    switch (debounce->algoritmo) {
+    case DEBOUNCE_ALG_TIMER:
+        return debounce->retardo.duration;
+    case DEBOUNCE_ALG_ADAPTIVE:
+        return debounce->adaptativo.ventana;
+    case DEBOUNCE_ALG_EAGER:
+        return debounce->anticipado.bloqueo.duration;
     default:
-        estadoActual = BUTTON_UP;
+        return 0;
     }
 }
 
-void button_Pressed() {
-    keyButtonDesc = true;
-    IO_Write(IO_LED_DEBUG, true);
+uint8_t debounce_AlgorithmStateSize(debounceAlgorithm_t algoritmo) {
+    return algoritmo < DEBOUNCE_ALG_COUNT ? algoritmos[algoritmo].tamanioEstado : 0;
 }
 
-void button_Released() {
-    keyButtonAsc = true;
-    IO_Write(IO_LED_DEBUG, false);
+void debounce_Update(debounce_t * debounce) {
+    debounce_UpdateAt(debounce, delayGetTick());
 }
 
-bool_t readKeyDesc() {
-    if (keyButtonDesc) {
-        keyButtonDesc = false;
+void debounce_UpdateAt(debounce_t * debounce, tick_t now) {
+    guardarEvento(debounce, debounceStep(debounce, NULL, now), now);
+}
+
+void debounce_UpdateSnapshot(debounce_t * debounce, IO_Snapshot_t snapshot) {
+    debounce_UpdateSnapshotAt(debounce, snapshot, delayGetTick());
+}
+
+void debounce_UpdateSnapshotAt(debounce_t * debounce, IO_Snapshot_t snapshot, tick_t now) {
+    guardarEvento(debounce, debounceStep(debounce, &snapshot, now), now);
+}
+
+bool_t debounce_ReadPressed(debounce_t * debounce) {
+    if (debounce->keyDesc) {
+        debounce->keyDesc = false;
         return true;
     }
     return false;
 }
 
-bool_t readKeyAsc() {
-    if (keyButtonAsc) {
-        keyButtonAsc = false;
+bool_t debounce_ReadReleased(debounce_t * debounce) {
+    if (debounce->keyAsc) {
+        debounce->keyAsc = false;
+        return true;
+    }
+    return false;
+}
+
+void debounce_SetMode(debounce_t * debounce, debounceMode_t modo) {
+    debounce->modo = modo;
+    atomic_store(&debounce->flanco, true);
+}
+
+void debounce_NotifyEdge(debounce_t * debounce) {
+    atomic_store(&debounce->flanco, true);
+}
+
+void debounce_NotifyDevice(IO_Device_t device) {
+    if (botonUsuario.device == device) {
+        debounce_NotifyEdge(&botonUsuario);
+    }
+    for (uint8_t i = 0; i < cantidadRegistradas; i++) {
+        if (registro[i]->device == device) {
+            debounce_NotifyEdge(registro[i]);
+        }
+    }
+}
+
+bool_t debounce_IsActive(debounce_t * debounce) {
+    return debounce->modo == DEBOUNCE_MODE_POLLING || debounce->estado == BUTTON_FALLING ||
+           debounce->estado == BUTTON_RISING || atomic_load(&debounce->flanco);
+}
+
+bool_t debounce_AnyActive(void) {
+    if (debounce_IsActive(&botonUsuario)) {
         return true;
     }
+    for (uint8_t i = 0; i < cantidadRegistradas; i++) {
+        if (debounce_IsActive(registro[i])) {
+            return true;
+        }
+    }
     return false;
 }
+
+bool_t debounce_ReadEvent(event_t * event) {
+    return eventQueue_Pop(&colaEventos, event);
+}
+
+void debounce_EventStats(eventQueueStats_t * stats) {
+    eventQueue_GetStats(&colaEventos, stats);
+}
+
+bool_t debounce_GetStats(const debounce_t * debounce, debounceStats_t * stats) {
+#if DEBOUNCE_STATS
+    *stats = debounce->stats;
+    return true;
+#else
+    (void)debounce;
+    *stats = (debounceStats_t){0};
+    return false;
+#endif
+}
+
+void debounce_ResetStats(debounce_t * debounce) {
+#if DEBOUNCE_STATS
+    debounce->stats = (debounceStats_t){0};
+#else
+    (void)debounce;
+#endif
+}
+
+IO_Snapshot_t debounce_WaitEvent(tick_t timeout, IO_Snapshot_t entradas) {
+    IO_Snapshot_t listos = tomarAvisos(entradas);
+
+    if (listos != 0 || timeout == 0) {
+        return listos;
+    }
+#if DEBOUNCE_WAIT_FUTEX
+    struct timespec limite;
+    uint64_t ns = (uint64_t)timeout * 1000000000ull / DELAY_TICK_HZ;
+
+    clock_gettime(CLOCK_MONOTONIC, &limite);
+    ns += (uint64_t)limite.tv_nsec;
+    limite.tv_sec += (time_t)(ns / 1000000000ull);
+    limite.tv_nsec = (long)(ns % 1000000000ull);
+
+    atomic_fetch_add(&esperando, 1u);
+    for (;;) {
+        unsigned int valor = atomic_load(&avisos);
+
+        if (valor & entradas) {
+            listos = tomarAvisos(entradas);
+            if (listos != 0) {
+                break;
+            }
+            continue;
+        }
+        /* Duerme solo si los avisos siguen valiendo lo que se leyó, el límite es absoluto */
+        if (syscall(SYS_futex, &avisos, FUTEX_WAIT_BITSET_PRIVATE, valor,
+                    timeout == DEBOUNCE_WAIT_FOREVER ? NULL : &limite, NULL,
+                    FUTEX_BITSET_MATCH_ANY) != 0 &&
+            errno == ETIMEDOUT) {
+            listos = tomarAvisos(entradas);
+            break;
+        }
+    }
+    atomic_fetch_sub(&esperando, 1u);
+#else
+    tick_t inicio = delayGetTick();
+
+    while (listos == 0 &&
+           (timeout == DEBOUNCE_WAIT_FOREVER || delayGetTick() - inicio < timeout)) {
+        /* Con las interrupciones deshabilitadas no se pierde un aviso entre la consulta y WFI */
+        __disable_irq();
+        listos = tomarAvisos(entradas);
+        if (listos == 0) {
+            __WFI();
+        }
+        __enable_irq();
+    }
+#endif
+    return listos;
+}
+
+bool_t debounce_Subscribe(debounce_t * debounce, debounceHandler_t onPress,
+                          debounceHandler_t onRelease, void * contexto) {
+#if DEBOUNCE_DESPACHO_DIRECTO
+    (void)debounce;
+    (void)onPress;
+    (void)onRelease;
+    (void)contexto;
+    return false;
+#else
+    suscriptor_t * suscriptor = NULL;
+
+    if (debounce->suscriptor != 0) {
+        suscriptor = &suscriptores[debounce->suscriptor - 1u];
+    } else {
+        for (uint8_t i = 0; i < DEBOUNCE_MAX_SUSCRIPTORES; i++) {
+            if (suscriptores[i].instancia == NULL) {
+                suscriptor = &suscriptores[i];
+                debounce->suscriptor = (uint8_t)(i + 1u);
+                break;
+            }
+        }
+        if (suscriptor == NULL) {
+            return false;
+        }
+    }
+    suscriptor->instancia = debounce;
+    suscriptor->onPress = onPress;
+    suscriptor->onRelease = onRelease;
+    suscriptor->contexto = contexto;
+    return true;
+#endif
+}
+
+void debounce_Unsubscribe(debounce_t * debounce) {
+    /* Recorre la tabla: al inicializar, el campo suscriptor puede tener basura de la pila */
+    for (uint8_t i = 0; i < DEBOUNCE_MAX_SUSCRIPTORES; i++) {
+        if (suscriptores[i].instancia == debounce) {
+            suscriptores[i] = (suscriptor_t){0};
+        }
+    }
+    debounce->suscriptor = 0;
+}
+
+void debounce_LedHandler(const event_t * event, void * contexto) {
+    (void)contexto;
+    ESCRIBIR_LED(event->edge == EVENT_PRESSED);
+}
+
+bool_t debounce_Register(debounce_t * debounce) {
+    if (debounce == NULL || cantidadRegistradas >= GPIO_MAX_INSTANCES) {
+        return false;
+    }
+    for (uint8_t i = 0; i < cantidadRegistradas; i++) {
+        if (registro[i] == debounce) {
+            return false;
+        }
+    }
+    registro[cantidadRegistradas++] = debounce;
+    return true;
+}
+
+void debounce_UpdateAll(void) {
+    debounce_UpdateAllAt(delayGetTick());
+}
+
+void debounce_UpdateAllAt(tick_t now) {
+    IO_Snapshot_t snapshot;
+
+    if (IO_ReadMany(&snapshot) != IO_OK) {
+        return;
+    }
+    for (uint8_t i = 0; i < cantidadRegistradas; i++) {
+        debounce_UpdateSnapshotAt(registro[i], snapshot, now);
+    }
+}
+
+/*Se inicializa la FEM indicando el estado inicial e inicializando el delay*/
+void debounceFSM_Init() {
+    debounceFSM_InitWith(DEBOUNCE_ALGORITMO);
+}
+
+bool_t debounceFSM_InitWith(debounceAlgorithm_t algoritmo) {
+    if (!debounce_InitWith(&botonUsuario, IO_BUTTON_USER, algoritmo)) {
+        return false;
+    }
+#if DEBOUNCE_LED_DEFAULT
+    ESCRIBIR_LED(false);
+    debounce_Subscribe(&botonUsuario, debounce_LedHandler, debounce_LedHandler, NULL);
+#endif
+    return true;
+}
+
+bool_t debounceFSM_SetEagerSamples(uint8_t muestras) {
+    return debounce_SetEagerSamples(&botonUsuario, muestras);
+}
+
+void debounceFSM_SetMode(debounceMode_t modo) {
+    debounce_SetMode(&botonUsuario, modo);
+}
+
+void debounceFSM_Update() {
+    debounceFSM_UpdateAt(delayGetTick());
+}
+
+void debounceFSM_UpdateAt(tick_t now) {
+    debounce_UpdateAt(&botonUsuario, now);
+}
+
+bool_t debounceFSM_GetStats(debounceStats_t * stats) {
+    return debounce_GetStats(&botonUsuario, stats);
+}
+
+bool_t debounceFSM_Subscribe(debounceHandler_t onPress, debounceHandler_t onRelease,
+                             void * contexto) {
+    return debounce_Subscribe(&botonUsuario, onPress, onRelease, contexto);
+}
+
+bool_t readKeyDesc() {
+    return debounce_ReadPressed(&botonUsuario);
+}
+
+bool_t readKeyAsc() {
+    return debounce_ReadReleased(&botonUsuario);
+}
 /* === End of documentation ==================================================================== */
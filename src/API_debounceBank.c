@@ -0,0 +1,185 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file API_debounceBank.c
+ * @brief Implementación del antirrebote temporizado como estructura de arreglos
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "API_debounceBank.h"
+#include <stddef.h>
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Máscara de las entradas existentes de una palabra
+ */
+static debounceBank_word_t mascaraPalabra(const debounceBank_t * bank, uint32_t palabra);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static debounceBank_word_t mascaraPalabra(const debounceBank_t * bank, uint32_t palabra) {
+    uint32_t resto = bank->cantidad - palabra * DEBOUNCE_BANK_WIDTH;
+
+    if (resto >= DEBOUNCE_BANK_WIDTH) {
+        return ~(debounceBank_word_t)0;
+    }
+    return ((debounceBank_word_t)1u << resto) - 1u;
+}
+
+/* === Public function implementation ========================================================== */
+
+bool_t debounceBank_Init(debounceBank_t * bank, uint32_t cantidad, debounceBank_word_t * bits,
+                         tick_t * vencimientos, tick_t duracion) {
+    if (bank == NULL || bits == NULL || vencimientos == NULL || cantidad == 0) {
+        return false;
+    }
+
+    bank->cantidad = cantidad;
+    bank->palabras = DEBOUNCE_BANK_WORDS(cantidad);
+    bank->duracion = duracion;
+    bank->nivel = bits;
+    bank->contando = bits + bank->palabras;
+    bank->presionadas = bits + 2u * bank->palabras;
+    bank->liberadas = bits + 3u * bank->palabras;
+    bank->vencimientos = vencimientos;
+
+    for (uint32_t i = 0; i < DEBOUNCE_BANK_BITS(cantidad); i++) {
+        bits[i] = 0;
+    }
+    return true;
+}
+
+uint32_t debounceBank_Update(debounceBank_t * bank, const debounceBank_word_t * muestra,
+                             tick_t now) {
+    uint32_t confirmados = 0;
+
+    for (uint32_t palabra = 0; palabra < bank->palabras; palabra++) {
+        debounceBank_word_t distintas = (muestra[palabra] ^ bank->nivel[palabra]) &
+                                        mascaraPalabra(bank, palabra);
+        debounceBank_word_t contando = bank->contando[palabra];
+        debounceBank_word_t nuevas = distintas & ~contando;
+        tick_t * vencimientos = &bank->vencimientos[palabra * DEBOUNCE_BANK_WIDTH];
+
+        /* Solo se visitan una a una las entradas con el retardo en curso */
+        while (contando != 0) {
+            uint8_t bit = (uint8_t)__builtin_ctz(contando);
+            debounceBank_word_t mascara = (debounceBank_word_t)1u << bit;
+
+            contando &= contando - 1;
+            if ((int32_t)(now - vencimientos[bit]) < 0) {
+                continue;
+            }
+            bank->contando[palabra] &= ~mascara;
+            if (distintas & mascara) {
+                bank->nivel[palabra] ^= mascara;
+                if (bank->nivel[palabra] & mascara) {
+                    bank->presionadas[palabra] |= mascara;
+                } else {
+                    bank->liberadas[palabra] |= mascara;
+                }
+                confirmados++;
+            }
+        }
+
+        /* Las entradas que recién cambian arrancan el retardo */
+        bank->contando[palabra] |= nuevas;
+        while (nuevas != 0) {
+            vencimientos[__builtin_ctz(nuevas)] = now + bank->duracion;
+            nuevas &= nuevas - 1;
+        }
+    }
+    return confirmados;
+}
+
+bool_t debounceBank_TakeEdges(debounceBank_t * bank, uint32_t palabra,
+                              debounceBank_word_t * pressed, debounceBank_word_t * released) {
+    if (palabra >= bank->palabras) {
+        *pressed = 0;
+        *released = 0;
+        return false;
+    }
+
+    *pressed = bank->presionadas[palabra];
+    *released = bank->liberadas[palabra];
+    bank->presionadas[palabra] = 0;
+    bank->liberadas[palabra] = 0;
+    return (*pressed | *released) != 0;
+}
+
+bool_t debounceBank_ReadPressed(debounceBank_t * bank, uint32_t entrada) {
+    uint32_t palabra = entrada / DEBOUNCE_BANK_WIDTH;
+    debounceBank_word_t mascara = (debounceBank_word_t)1u << (entrada % DEBOUNCE_BANK_WIDTH);
+
+    if (entrada >= bank->cantidad || (bank->presionadas[palabra] & mascara) == 0) {
+        return false;
+    }
+    bank->presionadas[palabra] &= ~mascara;
+    return true;
+}
+
+bool_t debounceBank_ReadReleased(debounceBank_t * bank, uint32_t entrada) {
+    uint32_t palabra = entrada / DEBOUNCE_BANK_WIDTH;
+    debounceBank_word_t mascara = (debounceBank_word_t)1u << (entrada % DEBOUNCE_BANK_WIDTH);
+
+    if (entrada >= bank->cantidad || (bank->liberadas[palabra] & mascara) == 0) {
+        return false;
+    }
+    bank->liberadas[palabra] &= ~mascara;
+    return true;
+}
+
+debounceState_t debounceBank_State(const debounceBank_t * bank, uint32_t entrada) {
+    uint32_t palabra = entrada / DEBOUNCE_BANK_WIDTH;
+    debounceBank_word_t mascara = (debounceBank_word_t)1u << (entrada % DEBOUNCE_BANK_WIDTH);
+    bool presionado, contando;
+
+    if (entrada >= bank->cantidad) {
+        return BUTTON_UP;
+    }
+    presionado = (bank->nivel[palabra] & mascara) != 0;
+    contando = (bank->contando[palabra] & mascara) != 0;
+
+    if (presionado) {
+        return contando ? BUTTON_RISING : BUTTON_DOWN;
+    }
+    return contando ? BUTTON_FALLING : BUTTON_UP;
+}
+
+uint32_t debounceBank_Footprint(uint32_t cantidad) {
+    return (uint32_t)(DEBOUNCE_BANK_BITS(cantidad) * sizeof(debounceBank_word_t) +
+                      cantidad * sizeof(tick_t) + sizeof(debounceBank_t));
+}
+
+/* === End of documentation ==================================================================== */
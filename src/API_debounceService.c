@@ -0,0 +1,495 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file API_debounceService.c
+ * @brief Servicio de antirrebote multihilo con shards, colas sin bloqueos y robo de trabajo
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions =============================================================== */
+#if defined(HAL_HOST) || defined(TEST)
+
+#include "API_debounceService.h"
+
+#include <sched.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* === Macros definitions ====================================================================== */
+/** @brief Tamaño de la línea de caché que separa los datos de productores y consumidores */
+#define LINEA_CACHE 64u
+
+_Static_assert((DEBOUNCE_SERVICE_COLA & (DEBOUNCE_SERVICE_COLA - 1u)) == 0,
+               "DEBOUNCE_SERVICE_COLA debe ser potencia de 2");
+_Static_assert(DEBOUNCE_SERVICE_SHARDS_POR_HILO >= 1, "Se necesita al menos un shard por hilo");
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @struct celda_t
+ * @brief Posición de la cola acotada de un shard
+ * @details La secuencia indica de quién es la celda: igual a la posición de escritura si está
+ * libre para un productor, y una más si tiene una muestra lista para el consumidor
+ */
+typedef struct {
+    atomic_uint secuencia; /**< Vuelta de la cola a la que pertenece la celda */
+    uint32_t dato;         /**< Entrada relativa al shard en los bits 31..1, nivel en el 0 */
+} celda_t;
+
+/**
+ * @struct debounceShard_s
+ * @brief Rango contiguo de entradas con su banco y su cola
+ * @details La primera línea de caché la escriben los productores, la segunda solo el hilo que
+ * tiene tomado el shard. Los demás hilos solo leen las posiciones para decidir si roban
+ */
+struct debounceShard_s {
+    _Alignas(LINEA_CACHE) atomic_uint escritura; /**< Próxima posición a escribir */
+    _Atomic uint64_t descartadas;                /**< Muestras rechazadas por cola llena */
+
+    _Alignas(LINEA_CACHE) atomic_uint lectura;   /**< Próxima posición a leer */
+    atomic_flag ocupado;                         /**< Tomado por un hilo */
+    bool_t pendiente;                            /**< Hubo muestras en la última vuelta */
+    tick_t ultimoTick;                           /**< Tick de la última actualización del banco */
+    uint32_t primera;                            /**< Primera entrada del shard */
+    _Atomic uint64_t muestras;                   /**< Muestras aplicadas */
+    _Atomic uint64_t robadas;                    /**< Muestras aplicadas por otro hilo */
+    _Atomic uint64_t eventos;                    /**< Flancos entregados */
+    debounceBank_t bank;                         /**< Antirrebote de las entradas del shard */
+    debounceBank_word_t * muestra;               /**< Último nivel encolado de cada entrada */
+    celda_t * celdas;                            /**< Cola de DEBOUNCE_SERVICE_COLA celdas */
+};
+
+/**
+ * @struct debounceWorker_s
+ * @brief Parámetros de un hilo trabajador
+ */
+struct debounceWorker_s {
+    debounceService_t * service; /**< Servicio al que pertenece */
+    pthread_t hilo;              /**< Hilo POSIX */
+    uint32_t indice;             /**< Posición del hilo, define sus shards propios */
+    uint32_t proximoRobo;        /**< Shard desde el que empieza a buscar trabajo ajeno */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Reserva la memoria de un shard e inicializa su banco y su cola
+ * @return false si no hay memoria o no se pudo iniciar el banco, sin dejar memoria reservada
+ */
+static bool_t iniciarShard(debounceShard_t * shard, uint32_t primera, uint32_t cantidad,
+                           tick_t duracion);
+
+/**
+ * @brief Agrega una muestra a la cola de un shard, apto para varios productores
+ * @return false si la cola está llena
+ */
+static bool_t encolar(debounceShard_t * shard, uint32_t dato);
+
+/**
+ * @brief Saca la próxima muestra de la cola, solo la llama quien tiene tomado el shard
+ * @return false si la cola está vacía
+ */
+static bool_t desencolar(debounceShard_t * shard, uint32_t * dato);
+
+/**
+ * @brief Muestras encoladas que todavía no se procesaron, estimación para decidir un robo
+ */
+static uint32_t pendientes(const debounceShard_t * shard);
+
+/**
+ * @brief Entrega al manejador los flancos confirmados del banco de un shard
+ */
+static void despachar(debounceService_t * service, debounceShard_t * shard, tick_t now);
+
+/**
+ * @brief Aplica un lote de muestras y actualiza el banco, con el shard ya tomado
+ * @param robado true si lo procesa un hilo distinto del dueño
+ * @return Muestras aplicadas
+ */
+static uint32_t procesarShard(debounceService_t * service, debounceShard_t * shard, tick_t now,
+                              bool_t robado);
+
+/**
+ * @brief Toma un shard si está libre, lo procesa y lo libera
+ * @return Muestras aplicadas, 0 si otro hilo lo tenía tomado
+ */
+static uint32_t tomarShard(debounceService_t * service, debounceShard_t * shard, tick_t now,
+                           bool_t robado);
+
+/**
+ * @brief Busca un shard ajeno con la cola cargada y lo procesa
+ * @return Muestras aplicadas
+ */
+static uint32_t robar(debounceWorker_t * trabajador, tick_t now);
+
+/**
+ * @brief Lazo de un hilo trabajador
+ */
+static void * trabajar(void * argumento);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static bool_t iniciarShard(debounceShard_t * shard, uint32_t primera, uint32_t cantidad,
+                           tick_t duracion) {
+    size_t bytesCeldas = DEBOUNCE_SERVICE_COLA * sizeof(celda_t);
+    size_t bytesBits = DEBOUNCE_BANK_BITS(cantidad) * sizeof(debounceBank_word_t);
+    size_t bytesVencimientos = cantidad * sizeof(tick_t);
+    size_t bytesMuestra = DEBOUNCE_BANK_WORDS(cantidad) * sizeof(debounceBank_word_t);
+    size_t total = bytesCeldas + bytesBits + bytesVencimientos + bytesMuestra;
+    uint8_t * memoria;
+
+    /* Una sola reserva por shard, redondeada a la línea para no compartirla con otro shard */
+    total = (total + LINEA_CACHE - 1u) & ~(size_t)(LINEA_CACHE - 1u);
+    memoria = aligned_alloc(LINEA_CACHE, total);
+    if (memoria == NULL) {
+        return false;
+    }
+
+    shard->celdas = (celda_t *)memoria;
+    shard->muestra = (debounceBank_word_t *)(memoria + bytesCeldas + bytesBits + bytesVencimientos);
+    for (uint32_t i = 0; i < DEBOUNCE_SERVICE_COLA; i++) {
+        atomic_init(&shard->celdas[i].secuencia, i);
+    }
+    for (uint32_t i = 0; i < DEBOUNCE_BANK_WORDS(cantidad); i++) {
+        shard->muestra[i] = 0;
+    }
+    atomic_init(&shard->escritura, 0);
+    atomic_init(&shard->lectura, 0);
+    atomic_init(&shard->descartadas, 0);
+    atomic_init(&shard->muestras, 0);
+    atomic_init(&shard->robadas, 0);
+    atomic_init(&shard->eventos, 0);
+    atomic_flag_clear(&shard->ocupado);
+    shard->pendiente = false;
+    shard->ultimoTick = 0;
+    shard->primera = primera;
+    if (!debounceBank_Init(&shard->bank, cantidad, (debounceBank_word_t *)(memoria + bytesCeldas),
+                           (tick_t *)(memoria + bytesCeldas + bytesBits), duracion)) {
+        /* El llamador no cuenta este shard al destruir el servicio */
+        free(memoria);
+        shard->celdas = NULL;
+        return false;
+    }
+    return true;
+}
+
+static bool_t encolar(debounceShard_t * shard, uint32_t dato) {
+    unsigned int posicion = atomic_load_explicit(&shard->escritura, memory_order_relaxed);
+    celda_t * celda;
+
+    for (;;) {
+        celda = &shard->celdas[posicion & (DEBOUNCE_SERVICE_COLA - 1u)];
+        unsigned int secuencia = atomic_load_explicit(&celda->secuencia, memory_order_acquire);
+        int32_t diferencia = (int32_t)(secuencia - posicion);
+
+        if (diferencia == 0) {
+            if (atomic_compare_exchange_weak_explicit(&shard->escritura, &posicion, posicion + 1u,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                break;
+            }
+        } else if (diferencia < 0) {
+            return false;
+        } else {
+            posicion = atomic_load_explicit(&shard->escritura, memory_order_relaxed);
+        }
+    }
+    celda->dato = dato;
+    atomic_store_explicit(&celda->secuencia, posicion + 1u, memory_order_release);
+    return true;
+}
+
+static bool_t desencolar(debounceShard_t * shard, uint32_t * dato) {
+    unsigned int posicion = atomic_load_explicit(&shard->lectura, memory_order_relaxed);
+    celda_t * celda = &shard->celdas[posicion & (DEBOUNCE_SERVICE_COLA - 1u)];
+    unsigned int secuencia = atomic_load_explicit(&celda->secuencia, memory_order_acquire);
+
+    if (secuencia != posicion + 1u) {
+        return false;
+    }
+    *dato = celda->dato;
+    atomic_store_explicit(&celda->secuencia, posicion + DEBOUNCE_SERVICE_COLA,
+                          memory_order_release);
+    atomic_store_explicit(&shard->lectura, posicion + 1u, memory_order_relaxed);
+    return true;
+}
+
+static uint32_t pendientes(const debounceShard_t * shard) {
+    return atomic_load_explicit(&shard->escritura, memory_order_relaxed) -
+           atomic_load_explicit(&shard->lectura, memory_order_relaxed);
+}
+
+static void despachar(debounceService_t * service, debounceShard_t * shard, tick_t now) {
+    debounceServiceHandler_t handler = service->config.handler;
+    debounceServiceEvent_t event = {.tick = now};
+    debounceBank_word_t flancos[2];
+    uint64_t entregados = 0;
+
+    for (uint32_t palabra = 0; palabra < shard->bank.palabras; palabra++) {
+        if (!debounceBank_TakeEdges(&shard->bank, palabra, &flancos[0], &flancos[1])) {
+            continue;
+        }
+        for (uint8_t tipo = 0; tipo < 2; tipo++) {
+            event.edge = (tipo == 0) ? EVENT_PRESSED : EVENT_RELEASED;
+            while (flancos[tipo] != 0) {
+                uint8_t bit = (uint8_t)__builtin_ctz(flancos[tipo]);
+
+                flancos[tipo] &= flancos[tipo] - 1u;
+                event.entrada = shard->primera + palabra * DEBOUNCE_BANK_WIDTH + bit;
+                if (handler != NULL) {
+                    handler(&event, service->config.contexto);
+                }
+                entregados++;
+            }
+        }
+    }
+    atomic_fetch_add_explicit(&shard->eventos, entregados, memory_order_relaxed);
+}
+
+static uint32_t procesarShard(debounceService_t * service, debounceShard_t * shard, tick_t now,
+                              bool_t robado) {
+    uint32_t aplicadas = 0;
+    uint32_t dato;
+
+    while (aplicadas < DEBOUNCE_SERVICE_LOTE && desencolar(shard, &dato)) {
+        uint32_t entrada = dato >> 1;
+        debounceBank_word_t mascara = (debounceBank_word_t)1u << (entrada % DEBOUNCE_BANK_WIDTH);
+
+        if (dato & 1u) {
+            shard->muestra[entrada / DEBOUNCE_BANK_WIDTH] |= mascara;
+        } else {
+            shard->muestra[entrada / DEBOUNCE_BANK_WIDTH] &= ~mascara;
+        }
+        aplicadas++;
+    }
+
+    /* Sin muestras nuevas el banco solo cambia si avanzó el tick, salvo que en la vuelta
+       anterior hayan empezado retardos que ya vencen en este mismo tick */
+    if (aplicadas == 0 && !shard->pendiente && now == shard->ultimoTick) {
+        return 0;
+    }
+    shard->pendiente = aplicadas > 0;
+    shard->ultimoTick = now;
+    if (debounceBank_Update(&shard->bank, shard->muestra, now) > 0) {
+        despachar(service, shard, now);
+    }
+    if (aplicadas > 0) {
+        atomic_fetch_add_explicit(&shard->muestras, aplicadas, memory_order_relaxed);
+        if (robado) {
+            atomic_fetch_add_explicit(&shard->robadas, aplicadas, memory_order_relaxed);
+        }
+    }
+    return aplicadas;
+}
+
+static uint32_t tomarShard(debounceService_t * service, debounceShard_t * shard, tick_t now,
+                           bool_t robado) {
+    uint32_t aplicadas;
+
+    if (atomic_flag_test_and_set_explicit(&shard->ocupado, memory_order_acquire)) {
+        return 0;
+    }
+    aplicadas = procesarShard(service, shard, now, robado);
+    atomic_flag_clear_explicit(&shard->ocupado, memory_order_release);
+    return aplicadas;
+}
+
+static uint32_t robar(debounceWorker_t * trabajador, tick_t now) {
+    debounceService_t * service = trabajador->service;
+    uint32_t cantidad = service->cantidadShards;
+
+    for (uint32_t n = 0; n < cantidad; n++) {
+        uint32_t i = (trabajador->proximoRobo + n) % cantidad;
+        debounceShard_t * shard = &service->shards[i];
+
+        if (i % service->hilosActivos == trabajador->indice ||
+            pendientes(shard) < DEBOUNCE_SERVICE_ROBO) {
+            continue;
+        }
+        uint32_t aplicadas = tomarShard(service, shard, now, true);
+        if (aplicadas > 0) {
+            trabajador->proximoRobo = i + 1u;
+            return aplicadas;
+        }
+    }
+    return 0;
+}
+
+static void * trabajar(void * argumento) {
+    debounceWorker_t * trabajador = argumento;
+    debounceService_t * service = trabajador->service;
+    const struct timespec siesta = {0, DEBOUNCE_SERVICE_SIESTA_NS};
+    uint32_t ociosas = 0;
+
+    while (atomic_load_explicit(&service->corriendo, memory_order_acquire)) {
+        tick_t now = delayGetTick();
+        uint32_t aplicadas = 0;
+
+        for (uint32_t i = trabajador->indice; i < service->cantidadShards;
+             i += service->hilosActivos) {
+            aplicadas += tomarShard(service, &service->shards[i], now, false);
+        }
+        if (aplicadas == 0) {
+            aplicadas = robar(trabajador, now);
+        }
+
+        if (aplicadas > 0) {
+            ociosas = 0;
+        } else if (++ociosas < DEBOUNCE_SERVICE_GIROS) {
+            sched_yield();
+        } else {
+            nanosleep(&siesta, NULL);
+        }
+    }
+    return NULL;
+}
+
+/* === Public function implementation ========================================================== */
+
+bool_t debounceService_Init(debounceService_t * service, const debounceServiceConfig_t * config) {
+    uint32_t entradas;
+    uint32_t shards;
+    uint32_t porShard;
+
+    if (service == NULL || config == NULL || config->entradas == 0) {
+        return false;
+    }
+    entradas = config->entradas;
+    shards = (config->hilos > 0 ? config->hilos : 1u) * DEBOUNCE_SERVICE_SHARDS_POR_HILO;
+    porShard = DEBOUNCE_BANK_WORDS((entradas + shards - 1u) / shards) * DEBOUNCE_BANK_WIDTH;
+
+    service->config = *config;
+    service->entradasPorShard = porShard;
+    service->cantidadShards = (entradas + porShard - 1u) / porShard;
+    service->hilosActivos = 0;
+    atomic_init(&service->corriendo, false);
+    service->trabajadores = calloc(config->hilos > 0 ? config->hilos : 1u,
+                                   sizeof(debounceWorker_t));
+    service->shards = aligned_alloc(LINEA_CACHE, service->cantidadShards * sizeof(debounceShard_t));
+    if (service->trabajadores == NULL || service->shards == NULL) {
+        free(service->trabajadores);
+        free(service->shards);
+        return false;
+    }
+
+    for (uint32_t i = 0; i < service->cantidadShards; i++) {
+        uint32_t primera = i * porShard;
+        uint32_t cantidad = (entradas - primera < porShard) ? entradas - primera : porShard;
+
+        if (!iniciarShard(&service->shards[i], primera, cantidad, config->duracion)) {
+            service->cantidadShards = i;
+            debounceService_Destroy(service);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool_t debounceService_Start(debounceService_t * service) {
+    if (service->config.hilos == 0 || service->hilosActivos > 0) {
+        return false;
+    }
+    atomic_store_explicit(&service->corriendo, true, memory_order_release);
+    /* hilosActivos se fija antes de lanzar: reparte los shards propios de cada hilo */
+    service->hilosActivos = service->config.hilos;
+    for (uint8_t i = 0; i < service->config.hilos; i++) {
+        debounceWorker_t * trabajador = &service->trabajadores[i];
+
+        trabajador->service = service;
+        trabajador->indice = i;
+        trabajador->proximoRobo = i + 1u;
+        if (pthread_create(&trabajador->hilo, NULL, trabajar, trabajador) != 0) {
+            /* Los hilos ya lanzados se detienen; sus shards no quedan atendidos */
+            service->hilosActivos = i;
+            debounceService_Stop(service);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool_t debounceService_Push(debounceService_t * service, uint32_t entrada, bool_t nivel) {
+    debounceShard_t * shard;
+
+    if (entrada >= service->config.entradas) {
+        return false;
+    }
+    shard = &service->shards[entrada / service->entradasPorShard];
+    if (!encolar(shard, ((entrada - shard->primera) << 1) | (nivel ? 1u : 0u))) {
+        atomic_fetch_add_explicit(&shard->descartadas, 1u, memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+uint32_t debounceService_Poll(debounceService_t * service, tick_t now) {
+    uint32_t aplicadas = 0;
+
+    for (uint32_t i = 0; i < service->cantidadShards; i++) {
+        aplicadas += tomarShard(service, &service->shards[i], now, false);
+    }
+    return aplicadas;
+}
+
+void debounceService_Stop(debounceService_t * service) {
+    atomic_store_explicit(&service->corriendo, false, memory_order_release);
+    for (uint8_t i = 0; i < service->hilosActivos; i++) {
+        pthread_join(service->trabajadores[i].hilo, NULL);
+    }
+    service->hilosActivos = 0;
+}
+
+void debounceService_Destroy(debounceService_t * service) {
+    debounceService_Stop(service);
+    for (uint32_t i = 0; i < service->cantidadShards; i++) {
+        free(service->shards[i].celdas);
+    }
+    free(service->shards);
+    free(service->trabajadores);
+    service->shards = NULL;
+    service->trabajadores = NULL;
+    service->cantidadShards = 0;
+}
+
+void debounceService_GetStats(const debounceService_t * service, debounceServiceStats_t * stats) {
+    *stats = (debounceServiceStats_t){0};
+    for (uint32_t i = 0; i < service->cantidadShards; i++) {
+        debounceShard_t * shard = &service->shards[i];
+
+        stats->muestras += atomic_load_explicit(&shard->muestras, memory_order_relaxed);
+        stats->robadas += atomic_load_explicit(&shard->robadas, memory_order_relaxed);
+        stats->descartadas += atomic_load_explicit(&shard->descartadas, memory_order_relaxed);
+        stats->eventos += atomic_load_explicit(&shard->eventos, memory_order_relaxed);
+    }
+}
+
+#endif /* HAL_HOST || TEST */
+
+/* === End of documentation ==================================================================== */
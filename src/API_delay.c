@@ -27,13 +27,27 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions =============================================================== */
 #include "API_delay.h"
+#include "main.h"
+#include <stddef.h>
 
 /* === Macros definitions ====================================================================== */
-/** @brief Valor máximo permitido para un retardo */
-#define DELAY_MAX 2000
+/**
+ * @def DELAY_CLOCK
+ * @brief Fuente de reloj por defecto, una función sin parámetros que devuelve tick_t
+ */
+#ifndef DELAY_CLOCK
+#if DELAY_TICK_HZ == 1000u
+#define DELAY_CLOCK HAL_GetTick
+#elif DELAY_TICK_HZ == 1000000u && (defined(HAL_HOST) || defined(TEST))
+#define DELAY_CLOCK HAL_Host_GetMicros
+#else
+#error "DELAY_TICK_HZ sin fuente de reloj por defecto: definir DELAY_CLOCK"
+#endif
+#endif
 
-/** @brief Valor mínimo permitido para un retardo */
-#define DELAY_MIN 50
+/* Las comparaciones por diferencia solo distinguen vencimientos a menos de medio rango */
+_Static_assert(DELAY_MAX <= INT32_MAX, "DELAY_MAX debe ser menor que medio rango de tick_t");
+_Static_assert(DELAY_MIN <= DELAY_MAX, "DELAY_MIN no puede superar DELAY_MAX");
 /* === Private data type declarations ========================================================== */
 
 /* === Private variable declarations =========================================================== */
@@ -47,10 +61,62 @@ SPDX-License-Identifier: MIT
  */
 static tick_t checkDuration(tick_t duration);
 
+/**
+ * @brief Calcula el tick en el que vence un retardo
+ * @param delay Retardo a consultar
+ * @return startTime + duration
+ */
+static tick_t vencimiento(const delay_t * delay);
+
+/**
+ * @brief Indica si un retardo ya venció en un instante, de forma segura ante el desborde
+ * @return true si now alcanzó startTime + duration
+ */
+static bool vencido(const delay_t * delay, tick_t now);
+
+/**
+ * @brief Compara vencimientos de forma segura ante el desborde del contador de ticks
+ * @return true si a vence antes que b
+ * @details Los postergados se ordenan después de todos los demás, así no detienen el proceso
+ */
+static bool venceAntes(const delay_t * a, const delay_t * b);
+
+/**
+ * @brief Ubica un elemento del heap en una posición y actualiza su slot
+ */
+static void ubicar(uint16_t index, delay_t * delay);
+
+/**
+ * @brief Restablece la propiedad de heap moviendo un elemento hacia la raíz o hacia las hojas
+ * @param index Posición del elemento que cambió
+ */
+static void reubicar(uint16_t index);
+
+/**
+ * @brief Quita del heap el elemento de una posición
+ * @param index Posición del elemento a quitar
+ */
+static void quitar(uint16_t index);
+
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
 
+/** @brief Fuente de reloj de los retardos */
+static delayClock_t reloj = DELAY_CLOCK;
+
+/** @brief Min-heap de retardos ordenado por vencimiento */
+static delay_t * heap[DELAY_SERVICE_SIZE];
+/** @brief Cantidad de retardos en el heap */
+static uint16_t heapSize;
+
+/** @brief Llamadas a delayProcessAt() en curso, más de una si un callback la vuelve a llamar */
+static uint8_t procesando;
+/** @brief Tick de la llamada a delayProcessAt() más interna en curso */
+static tick_t procesandoEn;
+/** @brief Retardos marcados como postergados desde que comenzó la llamada más externa */
+static uint16_t postergados;
+
 /* === Private function implementation ========================================================= */
 static tick_t checkDuration(tick_t duration) {
     if (DELAY_MAX < duration) {
@@ -61,6 +127,64 @@ static tick_t checkDuration(tick_t duration) {
         return duration;
     }
 }
+
+static tick_t vencimiento(const delay_t * delay) {
+    return delay->startTime + delay->duration;
+}
+
+static bool vencido(const delay_t * delay, tick_t now) {
+    return (int32_t)(now - vencimiento(delay)) >= 0;
+}
+
+static bool venceAntes(const delay_t * a, const delay_t * b) {
+    if (a->postergado != b->postergado) {
+        return b->postergado;
+    }
+    return (int32_t)(vencimiento(a) - vencimiento(b)) < 0;
+}
+
+static void ubicar(uint16_t index, delay_t * delay) {
+    heap[index] = delay;
+    delay->slot = index + 1;
+}
+
+static void reubicar(uint16_t index) {
+    delay_t * delay = heap[index];
+
+    /* Hacia la raíz mientras venza antes que su padre */
+    while (index > 0 && venceAntes(delay, heap[(index - 1) / 2])) {
+        ubicar(index, heap[(index - 1) / 2]);
+        index = (index - 1) / 2;
+    }
+
+    /* Hacia las hojas mientras algún hijo venza antes */
+    for (;;) {
+        uint16_t hijo = 2 * index + 1;
+
+        if (hijo >= heapSize) {
+            break;
+        }
+        if (hijo + 1 < heapSize && venceAntes(heap[hijo + 1], heap[hijo])) {
+            hijo++;
+        }
+        if (!venceAntes(heap[hijo], delay)) {
+            break;
+        }
+        ubicar(index, heap[hijo]);
+        index = hijo;
+    }
+    ubicar(index, delay);
+}
+
+static void quitar(uint16_t index) {
+    heap[index]->slot = 0;
+    heapSize--;
+    if (index < heapSize) {
+        ubicar(index, heap[heapSize]);
+        reubicar(index);
+    }
+}
+
 /* === Public function implementation ========================================================== */
 
 void delayInit(delay_t * delay, tick_t duration) {
@@ -70,15 +194,22 @@ void delayInit(delay_t * delay, tick_t duration) {
     delay->duration = checkDuration(duration);
 
     delay->running = false; // asigna en delay.running "falso"
+    delay->postergado = false;
+    delay->slot = 0;
+    delay->callback = NULL;
 }
 
 // Funcion de delayRead con retorno de dato tipo bool_t (bool)
 bool_t delayRead(delay_t * delay) {
+    return delayReadAt(delay, reloj());
+}
+
+bool_t delayReadAt(delay_t * delay, tick_t now) {
 
     /*verifica el estado de delay.running
     si delay.running es falso, empieza conteo y cambia su estado a verdadero*/
     if (delay->running == false) {
-        delay->startTime = HAL_GetTick();
+        delay->startTime = now;
         delay->running = true;
 
     }
@@ -86,7 +217,7 @@ bool_t delayRead(delay_t * delay) {
     si se alcanzó, retorna "verdadero", y delay.running cambia a "falso";
     en caso contrario, retorna "falso"*/
     else {
-        if ((HAL_GetTick() - delay->startTime) >= delay->duration) {
+        if ((now - delay->startTime) >= delay->duration) {
             delay->running = false;
             return true;
         }
@@ -95,10 +226,107 @@ bool_t delayRead(delay_t * delay) {
     return false;
 }
 
+tick_t delayGetTick(void) {
+    return reloj();
+}
+
+void delay_SetClock(delayClock_t clock) {
+    reloj = (clock != NULL) ? clock : DELAY_CLOCK;
+}
+
 // Funcion de delayWrite sin retorno
 void delayWrite(delay_t * delay, tick_t duration) {
     /*Asigna un valor de duracion existente despues de revisar el rango
     con la funcion checkDuration*/
     delay->duration = checkDuration(duration);
+
+    /* Si está en el servicio su vencimiento cambió */
+    if (delay->slot != 0) {
+        reubicar(delay->slot - 1);
+    }
+}
+
+void delay_SetDuration(delay_t * delay, tick_t duration) {
+    delay->duration = (duration < DELAY_MAX) ? duration : DELAY_MAX;
+
+    if (delay->slot != 0) {
+        reubicar(delay->slot - 1);
+    }
+}
+
+bool_t delayStart(delay_t * delay, delayCallback_t callback) {
+    return delayStartAt(delay, callback, reloj());
+}
+
+bool_t delayStartAt(delay_t * delay, delayCallback_t callback, tick_t now) {
+    if (delay->slot == 0 && heapSize >= DELAY_SERVICE_SIZE) {
+        return false;
+    }
+
+    delay->startTime = now;
+    delay->running = true;
+    delay->callback = callback;
+    /* Si un callback lo inicia ya vencido se deja para la próxima llamada a delayProcessAt() */
+    delay->postergado = (procesando != 0) && vencido(delay, procesandoEn);
+    postergados += delay->postergado;
+
+    if (delay->slot == 0) {
+        ubicar(heapSize++, delay);
+    }
+    reubicar(delay->slot - 1);
+    return true;
+}
+
+void delayStop(delay_t * delay) {
+    if (delay->slot != 0) {
+        quitar(delay->slot - 1);
+    }
+    delay->running = false;
+}
+
+uint16_t delayProcess(void) {
+    return delayProcessAt(reloj());
+}
+
+uint16_t delayProcessAt(tick_t now) {
+    uint16_t vencidos = 0;
+    tick_t anterior = procesandoEn;
+
+    procesando++;
+    procesandoEn = now;
+
+    /* La raíz es el próximo vencimiento; si está postergada, también lo están todas las demás */
+    while (heapSize > 0 && vencido(heap[0], now) && !heap[0]->postergado) {
+        delay_t * delay = heap[0];
+
+        quitar(0);
+        delay->running = false;
+        vencidos++;
+        if (delay->callback != NULL) {
+            delay->callback(delay);
+        }
+    }
+
+    procesandoEn = anterior;
+    if (--procesando == 0 && postergados != 0) {
+        /* Solo pasa cuando un callback se reprogramó atrasado: sin las marcas cambia el orden y
+         * el heap se vuelve a armar insertando sus elementos de a uno */
+        uint16_t cantidad = heapSize;
+
+        for (heapSize = 0; heapSize < cantidad; heapSize++) {
+            heap[heapSize]->postergado = false;
+            reubicar(heapSize);
+        }
+        postergados = 0;
+    }
+    return vencidos;
+}
+
+bool_t delay_NextDeadline(tick_t * deadline) {
+    if (heapSize == 0) {
+        return false;
+    }
+    *deadline = vencimiento(heap[0]);
+    return true;
 }
 /* === End of documentation ==================================================================== */
@@ -0,0 +1,105 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+/**
+ * @file API_eventQueue.c
+ * @brief Implementación de la cola de eventos sin bloqueo
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "API_eventQueue.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Máscara para convertir un contador libre en índice del buffer */
+#define EVENT_QUEUE_MASK (EVENT_QUEUE_SIZE - 1u)
+
+_Static_assert((EVENT_QUEUE_SIZE & EVENT_QUEUE_MASK) == 0, "EVENT_QUEUE_SIZE debe ser potencia de 2");
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+void eventQueue_Init(eventQueue_t * queue) {
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->overflows, 0);
+    atomic_init(&queue->highWater, 0);
+}
+
+bool_t eventQueue_Push(eventQueue_t * queue, const event_t * event) {
+    uint32_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    uint32_t ocupacion = head - tail;
+
+    if (ocupacion >= EVENT_QUEUE_SIZE) {
+        atomic_fetch_add_explicit(&queue->overflows, 1, memory_order_relaxed);
+        return false;
+    }
+
+    queue->buffer[head & EVENT_QUEUE_MASK] = *event;
+    /* Publica el evento recién después de copiarlo */
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+    if (ocupacion + 1 > atomic_load_explicit(&queue->highWater, memory_order_relaxed)) {
+        atomic_store_explicit(&queue->highWater, (uint16_t)(ocupacion + 1), memory_order_relaxed);
+    }
+    return true;
+}
+
+bool_t eventQueue_Pop(eventQueue_t * queue, event_t * event) {
+    uint32_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+    if (head == tail) {
+        return false;
+    }
+
+    *event = queue->buffer[tail & EVENT_QUEUE_MASK];
+    /* Libera la posición recién después de copiar el evento */
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+uint16_t eventQueue_Count(eventQueue_t * queue) {
+    uint32_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    uint32_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+    return (uint16_t)(head - tail);
+}
+
+void eventQueue_GetStats(eventQueue_t * queue, eventQueueStats_t * stats) {
+    stats->pushed = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    stats->overflows = atomic_load_explicit(&queue->overflows, memory_order_relaxed);
+    stats->highWater = atomic_load_explicit(&queue->highWater, memory_order_relaxed);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,175 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file API_gesture.c
+ * @brief Implementación de los gestos sobre el servicio de temporizadores
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "API_gesture.h"
+#include <stddef.h>
+
+/* === Macros definitions ====================================================================== */
+
+_Static_assert(offsetof(gesture_t, temporizador) == 0,
+               "El retardo debe ser el primer miembro para recuperar la entrada en el vencimiento");
+
+/* === Private data type declarations ========================================================== */
+/**
+ * @enum gestoEstado_t
+ * @brief Estados del reconocedor de gestos
+ */
+typedef enum {
+    GESTO_REPOSO,         /**< Suelto, sin vencimientos */
+    GESTO_PRESIONADO,     /**< Primera presión, esperando pulsacionLarga */
+    GESTO_ESPERA_SEGUNDA, /**< Suelto tras una presión corta, esperando dobleClick */
+    GESTO_SEGUNDA,        /**< Segunda presión ya informada como doble click */
+    GESTO_MANTENIDO,      /**< Pulsación larga ya informada, repitiendo si corresponde */
+} gestoEstado_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Entrega un gesto a la función de la configuración
+ */
+static void emitir(gesture_t * gesture, gestureEvent_t evento, tick_t tick);
+
+/**
+ * @brief Programa el próximo vencimiento de una entrada
+ * @return false si el servicio de temporizadores está lleno
+ */
+static bool_t programar(gesture_t * gesture, tick_t duracion, tick_t desde);
+
+/**
+ * @brief Callback del servicio de temporizadores al vencer el retardo de una entrada
+ */
+static void vencer(delay_t * delay);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void emitir(gesture_t * gesture, gestureEvent_t evento, tick_t tick) {
+    if (gesture->config->callback != NULL) {
+        gesture->config->callback(gesture, evento, tick, gesture->config->contexto);
+    }
+}
+
+static bool_t programar(gesture_t * gesture, tick_t duracion, tick_t desde) {
+    delayWrite(&gesture->temporizador, duracion);
+    return delayStartAt(&gesture->temporizador, vencer, desde);
+}
+
+static void vencer(delay_t * delay) {
+    gesture_t * gesture = (gesture_t *)delay;
+    /* Se usa el vencimiento exacto para que la repetición no acumule atraso. Volver a programar
+     * no puede fallar: el servicio acaba de quitar este retardo y su lugar sigue libre */
+    tick_t tick = delay->startTime + delay->duration;
+
+    switch (gesture->estado) {
+    case GESTO_PRESIONADO:
+        gesture->estado = GESTO_MANTENIDO;
+        if (gesture->config->repeticion != 0) {
+            programar(gesture, gesture->config->repeticion, tick);
+        }
+        emitir(gesture, GESTURE_LONG_PRESS, tick);
+        break;
+    case GESTO_MANTENIDO:
+        programar(gesture, gesture->config->repeticion, tick);
+        emitir(gesture, GESTURE_REPEAT, tick);
+        break;
+    case GESTO_ESPERA_SEGUNDA:
+        gesture->estado = GESTO_REPOSO;
+        emitir(gesture, GESTURE_CLICK, tick);
+        break;
+    default:
+        break;
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void gesture_Init(gesture_t * gesture, uint16_t id, const gestureConfig_t * config) {
+    delayInit(&gesture->temporizador, DELAY_MIN);
+    gesture->config = config;
+    gesture->id = id;
+    gesture->estado = GESTO_REPOSO;
+}
+
+bool_t gesture_Feed(gesture_t * gesture, eventEdge_t edge, tick_t tick) {
+    const gestureConfig_t * config = gesture->config;
+    bool_t programado = true;
+
+    if (edge == EVENT_PRESSED) {
+        switch (gesture->estado) {
+        case GESTO_REPOSO:
+            gesture->estado = GESTO_PRESIONADO;
+            if (config->pulsacionLarga != 0) {
+                programado = programar(gesture, config->pulsacionLarga, tick);
+            }
+            break;
+        case GESTO_ESPERA_SEGUNDA:
+            delayStop(&gesture->temporizador);
+            gesture->estado = GESTO_SEGUNDA;
+            emitir(gesture, GESTURE_DOUBLE_CLICK, tick);
+            break;
+        default:
+            break;
+        }
+    } else if (edge == EVENT_RELEASED) {
+        switch (gesture->estado) {
+        case GESTO_PRESIONADO:
+            delayStop(&gesture->temporizador);
+            programado = (config->dobleClick == 0) || programar(gesture, config->dobleClick, tick);
+            if (config->dobleClick != 0 && programado) {
+                gesture->estado = GESTO_ESPERA_SEGUNDA;
+            } else {
+                gesture->estado = GESTO_REPOSO;
+                emitir(gesture, GESTURE_CLICK, tick);
+            }
+            break;
+        case GESTO_MANTENIDO:
+            delayStop(&gesture->temporizador);
+            gesture->estado = GESTO_REPOSO;
+            break;
+        case GESTO_SEGUNDA:
+            gesture->estado = GESTO_REPOSO;
+            break;
+        default:
+            break;
+        }
+    }
+    return programado;
+}
+
+void gesture_Reset(gesture_t * gesture) {
+    delayStop(&gesture->temporizador);
+    gesture->estado = GESTO_REPOSO;
+}
+
+/* === End of documentation ==================================================================== */
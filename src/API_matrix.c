@@ -0,0 +1,212 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file API_matrix.c
+ * @brief Implementación del barrido de teclados matriciales
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "API_matrix.h"
+#include <stddef.h>
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Reemplaza las teclas ambiguas por su estado del barrido anterior
+ * @param matrix Matriz barrida
+ * @param crudo Teclas leídas en este barrido
+ * @return Teclas leídas sin las que podrían ser fantasmas
+ */
+static uint64_t filtrarFantasmas(matrix_t * matrix, uint64_t crudo);
+
+/**
+ * @brief Agrega al reporte los flancos confirmados de una palabra de teclas
+ */
+static void reportarFlancos(matrixReport_t * reporte, uint32_t primera, debounceBank_word_t flancos,
+                            uint8_t presion);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static uint64_t filtrarFantasmas(matrix_t * matrix, uint64_t crudo) {
+    uint8_t filasColumna[MATRIX_MAX_COLUMNS] = {0};
+    uint64_t ambiguas = 0;
+
+    for (uint8_t f = 0; f < matrix->numFilas; f++) {
+        for (uint8_t c = 0; c < matrix->numColumnas; c++) {
+            if (crudo & ((uint64_t)1u << (f * matrix->numColumnas + c))) {
+                filasColumna[c] |= (uint8_t)(1u << f);
+            }
+        }
+    }
+
+    /* Dos columnas con dos o más filas en común forman al menos un rectángulo */
+    for (uint8_t c1 = 0; c1 < matrix->numColumnas; c1++) {
+        for (uint8_t c2 = c1 + 1; c2 < matrix->numColumnas; c2++) {
+            uint8_t comunes = filasColumna[c1] & filasColumna[c2];
+
+            if (__builtin_popcount(comunes) < 2) {
+                continue;
+            }
+            for (uint8_t f = 0; f < matrix->numFilas; f++) {
+                if (comunes & (1u << f)) {
+                    ambiguas |= (uint64_t)1u << (f * matrix->numColumnas + c1);
+                    ambiguas |= (uint64_t)1u << (f * matrix->numColumnas + c2);
+                }
+            }
+        }
+    }
+
+    if (ambiguas != 0) {
+        matrix->fantasmas++;
+        crudo = (crudo & ~ambiguas) | (matrix->crudo & ambiguas);
+    }
+    matrix->crudo = crudo;
+    return crudo;
+}
+
+static void reportarFlancos(matrixReport_t * reporte, uint32_t primera, debounceBank_word_t flancos,
+                            uint8_t presion) {
+    while (flancos != 0) {
+        uint8_t tecla = (uint8_t)(primera + __builtin_ctz(flancos));
+
+        reporte->teclas[reporte->cantidad++] = tecla | presion;
+        flancos &= flancos - 1;
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+bool_t matrix_Init(matrix_t * matrix, const IO_Device_t * columnas, uint8_t numColumnas,
+                   const IO_Device_t * filas, uint8_t numFilas, tick_t duracion) {
+    if (matrix == NULL || columnas == NULL || filas == NULL || numColumnas == 0 ||
+        numColumnas > MATRIX_MAX_COLUMNS || numFilas == 0 || numFilas > MATRIX_MAX_ROWS) {
+        return false;
+    }
+
+    matrix->mascaraColumnas = 0;
+    for (uint8_t c = 0; c < numColumnas; c++) {
+        if (columnas[c] >= IO_DEVICE_COUNT) {
+            return false;
+        }
+        matrix->columnas[c] = columnas[c];
+        matrix->mascaraColumnas |= IO_MASK(columnas[c]);
+    }
+    for (uint8_t f = 0; f < numFilas; f++) {
+        if (filas[f] >= IO_DEVICE_COUNT) {
+            return false;
+        }
+        matrix->filas[f] = filas[f];
+    }
+
+    matrix->numColumnas = numColumnas;
+    matrix->numFilas = numFilas;
+    matrix->esperar = NULL;
+    matrix->contexto = NULL;
+    matrix->crudo = 0;
+    matrix->fantasmas = 0;
+
+    /* Columnas en reposo hasta el primer barrido */
+    IO_WriteMask(0, matrix->mascaraColumnas);
+    IO_Flush();
+
+    return debounceBank_Init(&matrix->bank, (uint32_t)numColumnas * numFilas, matrix->bits,
+                             matrix->vencimientos, duracion);
+}
+
+void matrix_SetSettle(matrix_t * matrix, matrixSettle_t esperar, void * contexto) {
+    matrix->esperar = esperar;
+    matrix->contexto = contexto;
+}
+
+uint8_t matrix_Scan(matrix_t * matrix, tick_t now, matrixReport_t * reporte) {
+    debounceBank_word_t muestra[DEBOUNCE_BANK_WORDS(MATRIX_MAX_KEYS)];
+    matrixReport_t descartado;
+    uint64_t crudo = 0;
+
+    if (reporte == NULL) {
+        reporte = &descartado;
+    }
+    reporte->cantidad = 0;
+
+    for (uint8_t c = 0; c < matrix->numColumnas; c++) {
+        IO_Snapshot_t columna = IO_MASK(matrix->columnas[c]);
+        IO_Snapshot_t snapshot;
+
+        /* Apagar la columna anterior y encender esta es una escritura por puerto */
+        IO_WriteMask(columna, matrix->mascaraColumnas & ~columna);
+        IO_Flush();
+        if (matrix->esperar != NULL) {
+            matrix->esperar(matrix->contexto);
+        }
+        if (IO_ReadMany(&snapshot) != IO_OK) {
+            continue;
+        }
+        for (uint8_t f = 0; f < matrix->numFilas; f++) {
+            if (IO_SNAPSHOT_STATE(snapshot, matrix->filas[f])) {
+                crudo |= (uint64_t)1u << (f * matrix->numColumnas + c);
+            }
+        }
+    }
+    IO_WriteMask(0, matrix->mascaraColumnas);
+    IO_Flush();
+
+    crudo = filtrarFantasmas(matrix, crudo);
+    muestra[0] = (debounceBank_word_t)crudo;
+    muestra[1] = (debounceBank_word_t)(crudo >> DEBOUNCE_BANK_WIDTH);
+    if (debounceBank_Update(&matrix->bank, muestra, now) == 0) {
+        return 0;
+    }
+
+    for (uint32_t p = 0; p < matrix->bank.palabras; p++) {
+        debounceBank_word_t pressed, released;
+
+        if (debounceBank_TakeEdges(&matrix->bank, p, &pressed, &released)) {
+            reportarFlancos(reporte, p * DEBOUNCE_BANK_WIDTH, released, 0);
+            reportarFlancos(reporte, p * DEBOUNCE_BANK_WIDTH, pressed, MATRIX_KEY_PRESSED);
+        }
+    }
+    return reporte->cantidad;
+}
+
+bool_t matrix_IsPressed(const matrix_t * matrix, uint8_t tecla) {
+    debounceState_t estado = debounceBank_State(&matrix->bank, tecla);
+
+    return estado == BUTTON_DOWN || estado == BUTTON_RISING;
+}
+
+uint32_t matrix_GhostCount(const matrix_t * matrix) {
+    return matrix->fantasmas;
+}
+
+/* === End of documentation ==================================================================== */
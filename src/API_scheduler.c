@@ -0,0 +1,329 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file API_scheduler.c
+ * @brief Implementación del planificador cooperativo sobre el servicio de temporizadores
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "API_scheduler.h"
+#include "main.h"
+#include <stddef.h>
+
+/* === Macros definitions ====================================================================== */
+
+_Static_assert(offsetof(schedulerTask_t, temporizador) == 0,
+               "El retardo debe ser el primer miembro para recuperar la tarea en el vencimiento");
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Indica si una tarea se despacha antes que otra: menor prioridad y luego menor período
+ */
+static bool_t precede(const schedulerTask_t * a, const schedulerTask_t * b);
+
+/**
+ * @brief Activa un trabajo de una tarea, o cuenta una sobrecarga si el anterior no terminó
+ * @param activacion Tick de la activación
+ */
+static void activar(schedulerTask_t * tarea, tick_t activacion);
+
+/**
+ * @brief Callback del servicio de temporizadores en cada activación periódica
+ */
+static void vencer(delay_t * delay);
+
+/**
+ * @brief Atiende los pedidos de scheduler_Activate() y vence los retardos del servicio en ahora
+ */
+static void actualizar(void);
+
+/**
+ * @brief Busca la tarea lista de mayor prioridad que todavía no avanzó en la pasada actual
+ * @return La tarea, o NULL si no queda ninguna
+ */
+static schedulerTask_t * elegir(void);
+
+/**
+ * @brief Da un paso a una tarea y mide su duración
+ */
+static void avanzar(schedulerTask_t * tarea);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** @brief Tareas registradas, ordenadas de mayor a menor prioridad */
+static schedulerTask_t * tareas[SCHEDULER_MAX_TAREAS];
+/** @brief Cantidad de tareas registradas */
+static uint8_t cantidadTareas;
+/** @brief Número de la pasada en curso */
+static uint32_t pasada;
+/** @brief Tick leído al comenzar la pasada o al terminar el último paso */
+static tick_t ahora;
+/** @brief Alguna tarea tiene un scheduler_Activate() sin atender */
+static volatile bool_t hayAvisos;
+
+/* === Private function implementation ========================================================= */
+
+static bool_t precede(const schedulerTask_t * a, const schedulerTask_t * b) {
+    /* Las esporádicas no tienen período: van después de las periódicas de igual prioridad */
+    tick_t periodoA = (a->periodo != 0) ? a->periodo : UINT32_MAX;
+    tick_t periodoB = (b->periodo != 0) ? b->periodo : UINT32_MAX;
+
+    if (a->prioridad != b->prioridad) {
+        return a->prioridad < b->prioridad;
+    }
+    return periodoA < periodoB;
+}
+
+static void activar(schedulerTask_t * tarea, tick_t activacion) {
+    if (tarea->lista) {
+        /* El trabajo anterior sigue en curso, la activación se pierde */
+        tarea->estadisticas.sobrecargas++;
+        return;
+    }
+    tarea->lista = true;
+    tarea->iniciada = false;
+    tarea->activacion = activacion;
+    tarea->ejecucion = 0;
+}
+
+static void vencer(delay_t * delay) {
+    schedulerTask_t * tarea = (schedulerTask_t *)delay;
+    /* Se usa el vencimiento exacto para que las activaciones no acumulen atraso */
+    tick_t activacion = delay->startTime + delay->duration;
+    /* El tick real: un cuerpo de tarea puede llamar a delayProcess() entre dos pasos */
+    tick_t atraso = delayGetTick() - activacion;
+    tick_t perdidas = ((int32_t)atraso > 0) ? atraso / tarea->periodo : 0;
+
+    /* Si el lazo se atrasó más de un período se saltean las activaciones que ya pasaron */
+    if (perdidas != 0) {
+        tarea->estadisticas.sobrecargas += perdidas;
+        activacion += perdidas * tarea->periodo;
+    }
+    delayStartAt(delay, vencer, activacion);
+    activar(tarea, activacion);
+}
+
+static void actualizar(void) {
+    if (hayAvisos) {
+        /* Se baja antes de recorrer para no perder un aviso que llegue durante el recorrido */
+        hayAvisos = false;
+        for (uint8_t i = 0; i < cantidadTareas; i++) {
+            schedulerTask_t * tarea = tareas[i];
+
+            if (tarea->aviso && tarea->lista) {
+                /* Se atiende cuando termine el trabajo en curso */
+                hayAvisos = true;
+            } else if (tarea->aviso) {
+                tarea->aviso = false;
+                if (tarea->periodo != 0 && !tarea->temporizador.running) {
+                    delayStartAt(&tarea->temporizador, vencer, ahora);
+                }
+                activar(tarea, ahora);
+            }
+        }
+    }
+    delayProcessAt(ahora);
+}
+
+static schedulerTask_t * elegir(void) {
+    for (uint8_t i = 0; i < cantidadTareas; i++) {
+        if (tareas[i]->lista && tareas[i]->pasada != pasada) {
+            return tareas[i];
+        }
+    }
+    return NULL;
+}
+
+static void avanzar(schedulerTask_t * tarea) {
+    schedulerStats_t * stats = &tarea->estadisticas;
+    tick_t inicio = ahora;
+
+    if (!tarea->iniciada) {
+        tarea->iniciada = true;
+        if (inicio - tarea->activacion > stats->latenciaMax) {
+            stats->latenciaMax = inicio - tarea->activacion;
+        }
+    }
+    tarea->pasada = pasada;
+
+    schedulerResult_t resultado = tarea->funcion(tarea, tarea->contexto);
+
+    ahora = delayGetTick();
+    tarea->ejecucion += ahora - inicio;
+    if (resultado == SCHEDULER_DONE && tarea->lista) {
+        tarea->lista = false;
+        stats->ejecuciones++;
+        stats->ejecucionTotal += tarea->ejecucion;
+        if (tarea->ejecucion > stats->ejecucionMax) {
+            stats->ejecucionMax = tarea->ejecucion;
+        }
+        if (tarea->plazo != 0 && ahora - tarea->activacion > tarea->plazo) {
+            stats->sobrecargas++;
+        }
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void scheduler_Init(void) {
+    for (uint8_t i = 0; i < cantidadTareas; i++) {
+        delayStop(&tareas[i]->temporizador);
+    }
+    cantidadTareas = 0;
+    pasada = 0;
+    hayAvisos = false;
+}
+
+bool_t scheduler_Add(schedulerTask_t * tarea, schedulerTaskFn_t funcion, void * contexto,
+                     tick_t periodo, tick_t plazo, uint8_t prioridad) {
+    if (tarea == NULL || funcion == NULL || cantidadTareas >= SCHEDULER_MAX_TAREAS ||
+        periodo > DELAY_MAX || plazo > DELAY_MAX) {
+        return false;
+    }
+    for (uint8_t i = 0; i < cantidadTareas; i++) {
+        if (tareas[i] == tarea) {
+            return false;
+        }
+    }
+
+    delayInit(&tarea->temporizador, DELAY_MIN);
+    delay_SetDuration(&tarea->temporizador, periodo);
+    tarea->funcion = funcion;
+    tarea->contexto = contexto;
+    tarea->periodo = periodo;
+    tarea->plazo = (plazo != 0) ? plazo : periodo;
+    tarea->pasada = pasada;
+    tarea->linea = 0;
+    tarea->prioridad = prioridad;
+    tarea->lista = false;
+    tarea->aviso = false;
+    scheduler_ResetStats(tarea);
+
+    if (periodo != 0) {
+        ahora = delayGetTick();
+        if (!delayStartAt(&tarea->temporizador, vencer, ahora)) {
+            return false;
+        }
+        activar(tarea, ahora);
+    }
+
+    /* Inserción ordenada, las tareas se registran una vez al arrancar */
+    uint8_t i = cantidadTareas++;
+    while (i > 0 && precede(tarea, tareas[i - 1])) {
+        tareas[i] = tareas[i - 1];
+        i--;
+    }
+    tareas[i] = tarea;
+    return true;
+}
+
+void scheduler_Remove(schedulerTask_t * tarea) {
+    for (uint8_t i = 0; i < cantidadTareas; i++) {
+        if (tareas[i] == tarea) {
+            delayStop(&tarea->temporizador);
+            tarea->lista = false;
+            cantidadTareas--;
+            for (; i < cantidadTareas; i++) {
+                tareas[i] = tareas[i + 1];
+            }
+            return;
+        }
+    }
+}
+
+void scheduler_Activate(schedulerTask_t * tarea) {
+    tarea->aviso = true;
+    hayAvisos = true;
+}
+
+void scheduler_Suspend(schedulerTask_t * tarea) {
+    delayStop(&tarea->temporizador);
+}
+
+bool_t scheduler_Run(void) {
+    schedulerTask_t * tarea;
+    bool_t pendiente = false;
+
+    pasada++;
+    ahora = delayGetTick();
+    actualizar();
+    while ((tarea = elegir()) != NULL) {
+        avanzar(tarea);
+        actualizar();
+    }
+
+    for (uint8_t i = 0; i < cantidadTareas; i++) {
+        pendiente = pendiente || tareas[i]->lista;
+    }
+    return pendiente;
+}
+
+void scheduler_Idle(void) {
+    bool_t dormir;
+
+    do {
+        tick_t vencimiento;
+        bool_t hayVencimiento;
+
+        /* Con las interrupciones deshabilitadas no se pierde un aviso entre la consulta y WFI */
+        __disable_irq();
+        hayVencimiento = delay_NextDeadline(&vencimiento);
+        dormir = !hayAvisos && (!hayVencimiento || (int32_t)(vencimiento - delayGetTick()) > 0);
+        if (dormir && !hayVencimiento) {
+            /* Sin vencimientos solo una interrupción puede activar una tarea */
+            HAL_SuspendTick();
+            __WFI();
+            HAL_ResumeTick();
+        } else if (dormir) {
+            /* Despierta con el próximo SysTick o con la interrupción que pida una activación */
+            __WFI();
+        }
+        __enable_irq();
+    } while (dormir);
+}
+
+void scheduler_Loop(void) {
+    for (;;) {
+        if (!scheduler_Run()) {
+            scheduler_Idle();
+        }
+    }
+}
+
+void scheduler_GetStats(const schedulerTask_t * tarea, schedulerStats_t * stats) {
+    *stats = tarea->estadisticas;
+}
+
+void scheduler_ResetStats(schedulerTask_t * tarea) {
+    tarea->estadisticas = (schedulerStats_t){0};
+}
+
+/* === End of documentation ==================================================================== */
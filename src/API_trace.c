@@ -0,0 +1,323 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+/**
+ * @file API_trace.c
+ * @brief Implementación de la captura y reproducción de trazas de entradas
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "API_trace.h"
+#include <stddef.h>
+
+/* === Macros definitions ====================================================================== */
+/** @brief Largo máximo de un entero de 32 bits codificado en LEB128 */
+#define VARINT_MAX 5
+
+/** @brief Espacio reservado para la marca de final: delta de ticks y cero */
+#define TRACE_FIN_MAX (VARINT_MAX + 1)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/** @brief Identificador al comienzo de toda traza */
+static const uint8_t traceMagic[4] = {'D', 'B', 'T', 'R'};
+
+/** @brief Traza que recibe las lecturas de la capa IO, NULL si no se está grabando */
+static trace_t * traceActiva;
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Cantidad de bytes que ocupa un valor codificado en LEB128
+ * @param valor Valor a codificar
+ * @return Bytes necesarios, entre 1 y VARINT_MAX
+ */
+static uint8_t largoVarint(uint32_t valor);
+
+/**
+ * @brief Codifica un valor en LEB128 al final de la traza, sin verificar espacio
+ * @param trace Traza en escritura
+ * @param valor Valor a codificar
+ */
+static void escribirVarint(trace_t * trace, uint32_t valor);
+
+/**
+ * @brief Decodifica un valor en LEB128 desde la posición actual del lector
+ * @param reader Lector de la traza
+ * @param valor Puntero donde se copia el valor decodificado
+ * @return false si la traza se corta o el valor excede 32 bits
+ */
+static bool_t leerVarint(traceReader_t * reader, uint32_t * valor);
+
+/**
+ * @brief Función instalada con IO_SetReadHook() mientras hay una traza activa
+ * @param snapshot Lectura de las entradas
+ */
+static void grabarLectura(IO_Snapshot_t snapshot);
+
+/**
+ * @brief Notifica un flanco a las instancias cuyas entradas cambiaron
+ * @param instancias Instancias en reproducción
+ * @param cantidad Cantidad de instancias
+ * @param cambios Bits de las entradas que cambiaron
+ */
+static void notificarCambios(debounce_t * instancias, uint16_t cantidad, IO_Snapshot_t cambios);
+
+/**
+ * @brief Entrega al callback los eventos pendientes en la cola del antirrebote
+ * @param callback Función que recibe los eventos, puede ser NULL
+ * @param ctx Puntero de usuario para el callback
+ * @return Cantidad de eventos entregados
+ */
+static uint32_t despacharEventos(traceEventCallback_t callback, void * ctx);
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static uint8_t largoVarint(uint32_t valor) {
+    uint8_t largo = 1;
+
+    while (valor >= 0x80u) {
+        valor >>= 7;
+        largo++;
+    }
+    return largo;
+}
+
+static void escribirVarint(trace_t * trace, uint32_t valor) {
+    while (valor >= 0x80u) {
+        trace->buffer[trace->largo++] = (uint8_t)(valor | 0x80u);
+        valor >>= 7;
+    }
+    trace->buffer[trace->largo++] = (uint8_t)valor;
+}
+
+static bool_t leerVarint(traceReader_t * reader, uint32_t * valor) {
+    uint32_t resultado = 0;
+
+    for (uint8_t i = 0; i < VARINT_MAX; i++) {
+        uint8_t byte;
+
+        if (reader->posicion >= reader->largo) {
+            return false;
+        }
+        byte = reader->buffer[reader->posicion++];
+        resultado |= (uint32_t)(byte & 0x7Fu) << (7 * i);
+        if ((byte & 0x80u) == 0) {
+            *valor = resultado;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void grabarLectura(IO_Snapshot_t snapshot) {
+    if (traceActiva != NULL) {
+        trace_Record(traceActiva, delayGetTick(), snapshot);
+    }
+}
+
+static void notificarCambios(debounce_t * instancias, uint16_t cantidad, IO_Snapshot_t cambios) {
+    if (cambios == 0) {
+        return;
+    }
+    for (uint16_t i = 0; i < cantidad; i++) {
+        if (IO_SNAPSHOT_STATE(cambios, instancias[i].device)) {
+            debounce_NotifyEdge(&instancias[i]);
+        }
+    }
+}
+
+static uint32_t despacharEventos(traceEventCallback_t callback, void * ctx) {
+    event_t event;
+    uint32_t cantidad = 0;
+
+    while (debounce_ReadEvent(&event)) {
+        if (callback != NULL) {
+            callback(&event, ctx);
+        }
+        cantidad++;
+    }
+    return cantidad;
+}
+
+/* === Public function implementation ========================================================== */
+
+bool_t trace_InitWriter(trace_t * trace, uint8_t * buffer, uint32_t capacidad, tick_t inicio,
+                        IO_Snapshot_t inicial) {
+    trace->buffer = buffer;
+    trace->capacidad = capacidad;
+    trace->largo = 0;
+    trace->ultimoTick = inicio;
+    trace->ultimaMuestra = inicial;
+    trace->descartadas = 0;
+    trace->cerrada = false;
+
+    if (buffer == NULL || capacidad < TRACE_HEADER_MAX + TRACE_FIN_MAX) {
+        trace->capacidad = 0;
+        return false;
+    }
+    for (uint8_t i = 0; i < sizeof(traceMagic); i++) {
+        buffer[trace->largo++] = traceMagic[i];
+    }
+    buffer[trace->largo++] = TRACE_VERSION;
+    escribirVarint(trace, inicio);
+    escribirVarint(trace, inicial);
+    return true;
+}
+
+bool_t trace_Record(trace_t * trace, tick_t tick, IO_Snapshot_t muestra) {
+    IO_Snapshot_t cambios = muestra ^ trace->ultimaMuestra;
+    tick_t delta = tick - trace->ultimoTick;
+    uint32_t necesario;
+
+    if (cambios == 0) {
+        return true;
+    }
+    necesario = largoVarint(delta) + largoVarint(cambios) + TRACE_FIN_MAX;
+    if (trace->cerrada || trace->largo + necesario > trace->capacidad) {
+        trace->descartadas++;
+        return false;
+    }
+    escribirVarint(trace, delta);
+    escribirVarint(trace, cambios);
+    trace->ultimoTick = tick;
+    trace->ultimaMuestra = muestra;
+    return true;
+}
+
+bool_t trace_Finish(trace_t * trace, tick_t fin) {
+    if (trace->capacidad == 0 || trace->cerrada) {
+        return false;
+    }
+    escribirVarint(trace, fin - trace->ultimoTick);
+    escribirVarint(trace, 0);
+    trace->ultimoTick = fin;
+    trace->cerrada = true;
+    return trace->descartadas == 0;
+}
+
+void trace_Attach(trace_t * trace) {
+    traceActiva = trace;
+    IO_SetReadHook(trace != NULL ? grabarLectura : NULL);
+}
+
+bool_t trace_InitReader(traceReader_t * reader, const uint8_t * buffer, uint32_t largo) {
+    uint32_t valor;
+
+    reader->buffer = buffer;
+    reader->largo = largo;
+    reader->posicion = 0;
+    reader->completa = false;
+
+    if (buffer == NULL || largo < sizeof(traceMagic) + 1) {
+        return false;
+    }
+    for (uint8_t i = 0; i < sizeof(traceMagic); i++) {
+        if (buffer[i] != traceMagic[i]) {
+            return false;
+        }
+    }
+    if (buffer[sizeof(traceMagic)] != TRACE_VERSION) {
+        return false;
+    }
+    reader->posicion = sizeof(traceMagic) + 1;
+
+    if (!leerVarint(reader, &valor)) {
+        return false;
+    }
+    reader->inicio = valor;
+    if (!leerVarint(reader, &valor)) {
+        return false;
+    }
+    reader->inicial = valor;
+    reader->tick = reader->inicio;
+    reader->muestra = reader->inicial;
+    return true;
+}
+
+bool_t trace_Next(traceReader_t * reader, tick_t * tick, IO_Snapshot_t * muestra) {
+    uint32_t delta;
+    uint32_t cambios;
+
+    if (reader->completa || !leerVarint(reader, &delta) || !leerVarint(reader, &cambios)) {
+        return false;
+    }
+    reader->tick += delta;
+    if (cambios == 0) {
+        reader->completa = true;
+        return false;
+    }
+    reader->muestra ^= cambios;
+    *tick = reader->tick;
+    *muestra = reader->muestra;
+    return true;
+}
+
+uint32_t trace_Replay(traceReader_t * reader, debounce_t * instancias, uint16_t cantidad,
+                      tick_t periodo, traceEventCallback_t callback, void * ctx) {
+    tick_t now = reader->inicio;
+    IO_Snapshot_t muestra = reader->inicial;
+    tick_t proximoTick = now;
+    IO_Snapshot_t proximaMuestra = muestra;
+    bool_t hayProximo;
+    bool_t activas;
+    uint32_t eventos = 0;
+
+    if (periodo == 0) {
+        periodo = 1;
+    }
+    for (uint16_t i = 0; i < cantidad; i++) {
+        debounce_SetMode(&instancias[i], DEBOUNCE_MODE_INTERRUPT);
+    }
+    hayProximo = trace_Next(reader, &proximoTick, &proximaMuestra);
+
+    for (;;) {
+        while (hayProximo && (int32_t)(proximoTick - now) <= 0) {
+            notificarCambios(instancias, cantidad, muestra ^ proximaMuestra);
+            muestra = proximaMuestra;
+            hayProximo = trace_Next(reader, &proximoTick, &proximaMuestra);
+        }
+
+        activas = false;
+        for (uint16_t i = 0; i < cantidad; i++) {
+            debounce_UpdateSnapshotAt(&instancias[i], muestra, now);
+            eventos += despacharEventos(callback, ctx);
+            activas = activas || debounce_IsActive(&instancias[i]);
+        }
+
+        if (activas) {
+            now += periodo;
+        } else if (hayProximo) {
+            /* Sin rebotes en curso el tiempo salta al primer período que ve el próximo cambio */
+            now += ((proximoTick - now + periodo - 1) / periodo) * periodo;
+        } else {
+            break;
+        }
+    }
+    return eventos;
+}
+
+/* === End of documentation ==================================================================== */
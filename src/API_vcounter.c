@@ -0,0 +1,83 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+/**
+ * @file API_vcounter.c
+ * @brief Implementación del antirrebote por contadores verticales
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "API_vcounter.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+void vcounter_Init(vcounter_t * vcounter, vcounter_word_t inicial) {
+    vcounter->estado = inicial;
+    /* El contador en reposo vale 3 en todas las entradas y cuenta hacia atrás */
+    vcounter->cnt0 = ~(vcounter_word_t)0;
+    vcounter->cnt1 = ~(vcounter_word_t)0;
+}
+
+vcounter_word_t vcounter_Update(vcounter_t * vcounter, vcounter_word_t muestra,
+                                vcounter_word_t * pressed, vcounter_word_t * released) {
+    /* Entradas cuya muestra difiere del estado estable */
+    vcounter_word_t cambio = vcounter->estado ^ muestra;
+
+    /* Las entradas sin cambio vuelven a reposo, el resto decrementa su contador */
+    vcounter->cnt0 = ~(vcounter->cnt0 & cambio);
+    vcounter->cnt1 = vcounter->cnt0 ^ (vcounter->cnt1 & cambio);
+
+    /* Se confirma el cambio cuando el contador desborda */
+    cambio &= vcounter->cnt0 & vcounter->cnt1;
+    vcounter->estado ^= cambio;
+
+    *pressed = cambio & vcounter->estado;
+    *released = cambio & ~vcounter->estado;
+    return cambio;
+}
+
+debounceState_t vcounter_State(const vcounter_t * vcounter, uint8_t entrada) {
+    vcounter_word_t mascara = (vcounter_word_t)1 << entrada;
+    bool presionado = (vcounter->estado & mascara) != 0;
+    bool contando = ((vcounter->cnt0 & vcounter->cnt1) & mascara) == 0;
+
+    if (presionado) {
+        return contando ? BUTTON_RISING : BUTTON_DOWN;
+    }
+    return contando ? BUTTON_FALLING : BUTTON_UP;
+}
+
+/* === End of documentation ==================================================================== */
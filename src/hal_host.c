@@ -0,0 +1,247 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+/**
+ * @file hal_host.c
+ * @brief Implementación de la HAL para ejecutar el firmware en Linux
+ * @date 2025
+ * @author Verónica Ruíz Galván
+ */
+
+/* === Headers files inclusions =============================================================== */
+#if defined(HAL_HOST) || defined(TEST)
+
+#include "hal_host.h"
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+/** @brief Período del SysTick emulado en microsegundos */
+#define SYSTICK_US 1000
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Reemplaza la página de registros por un objeto de memoria compartida
+ * @param nombre Nombre del objeto para shm_open()
+ * @return true si la página quedó mapeada
+ */
+static bool mapearRegistros(const char * nombre);
+
+/**
+ * @brief Manejador de SIGUSR1: genera una interrupción por cada pin de entrada que cambió
+ */
+static void manejarFlanco(int senal);
+
+/**
+ * @brief Manejador de SIGALRM: solo despierta a HAL_Host_WaitForInterrupt()
+ */
+static void manejarTick(int senal);
+
+/* === Public variable definitions ============================================================= */
+
+hal_host_regs_t hal_host_regs __attribute__((aligned(HAL_HOST_PAGE)));
+
+/* === Private variable definitions ============================================================ */
+
+/** @brief Instante de HAL_Init(), origen de HAL_GetTick() */
+static struct timespec inicio;
+/** @brief Valor de IDR en la última interrupción, para detectar qué pines cambiaron */
+static uint32_t entradasPrevias[HAL_HOST_PORTS];
+/** @brief Señales que emulan interrupciones */
+static sigset_t interrupciones;
+
+/* === Private function implementation ========================================================= */
+
+static bool mapearRegistros(const char * nombre) {
+    void * pagina;
+    int fd = shm_open(nombre, O_RDWR | O_CREAT, 0600);
+
+    if (fd < 0) {
+        return false;
+    }
+    if (ftruncate(fd, HAL_HOST_PAGE) != 0) {
+        close(fd);
+        return false;
+    }
+    /* La página de hal_host_regs queda reemplazada por la compartida, con la misma dirección */
+    pagina = mmap(&hal_host_regs, HAL_HOST_PAGE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+                  fd, 0);
+    close(fd);
+    return pagina != MAP_FAILED;
+}
+
+static void manejarFlanco(int senal) {
+    (void)senal;
+
+    for (int puerto = 0; puerto < HAL_HOST_PORTS; puerto++) {
+        uint32_t actual = hal_host_regs.gpio[puerto].IDR;
+        uint32_t cambios = (actual ^ entradasPrevias[puerto]) & GPIO_PIN_All;
+
+        entradasPrevias[puerto] = actual;
+        while (cambios != 0) {
+            uint16_t pin = (uint16_t)(cambios & -cambios);
+
+            cambios &= cambios - 1;
+            HAL_GPIO_EXTI_Callback(pin);
+        }
+    }
+}
+
+static void manejarTick(int senal) {
+    (void)senal;
+}
+
+/* === Public function implementation ========================================================== */
+
+HAL_StatusTypeDef HAL_Init(void) {
+    struct sigaction accion = {0};
+    const char * nombre = getenv(HAL_HOST_SHM_ENV);
+
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+
+    if (nombre != NULL && !mapearRegistros(nombre)) {
+        return HAL_ERROR;
+    }
+    hal_host_regs.magic = HAL_HOST_MAGIC;
+    hal_host_regs.pid = (int32_t)getpid();
+    for (int puerto = 0; puerto < HAL_HOST_PORTS; puerto++) {
+        entradasPrevias[puerto] = hal_host_regs.gpio[puerto].IDR;
+    }
+
+    sigemptyset(&interrupciones);
+    sigaddset(&interrupciones, SIGUSR1);
+    sigaddset(&interrupciones, SIGALRM);
+
+    accion.sa_flags = SA_RESTART;
+    sigemptyset(&accion.sa_mask);
+    accion.sa_handler = manejarFlanco;
+    sigaction(SIGUSR1, &accion, NULL);
+    accion.sa_handler = manejarTick;
+    sigaction(SIGALRM, &accion, NULL);
+
+    HAL_ResumeTick();
+    return HAL_OK;
+}
+
+uint32_t HAL_GetTick(void) {
+    struct timespec ahora;
+
+    clock_gettime(CLOCK_MONOTONIC, &ahora);
+    return (uint32_t)((ahora.tv_sec - inicio.tv_sec) * 1000 +
+                      (ahora.tv_nsec - inicio.tv_nsec) / 1000000);
+}
+
+uint32_t HAL_Host_GetMicros(void) {
+    struct timespec ahora;
+
+    clock_gettime(CLOCK_MONOTONIC, &ahora);
+    /* La diferencia de tv_nsec es negativa cuando ahora está en la primera parte de un segundo */
+    return (uint32_t)(((int64_t)(ahora.tv_sec - inicio.tv_sec) * 1000000000 +
+                       (int64_t)(ahora.tv_nsec - inicio.tv_nsec)) /
+                      1000);
+}
+
+void HAL_Delay(uint32_t delay) {
+    uint32_t comienzo = HAL_GetTick();
+
+    while ((HAL_GetTick() - comienzo) < delay) {
+    }
+}
+
+void HAL_SuspendTick(void) {
+    struct itimerval periodo = {0};
+
+    setitimer(ITIMER_REAL, &periodo, NULL);
+}
+
+void HAL_ResumeTick(void) {
+    struct itimerval periodo = {
+        .it_interval = {.tv_sec = 0, .tv_usec = SYSTICK_US},
+        .it_value = {.tv_sec = 0, .tv_usec = SYSTICK_US},
+    };
+
+    setitimer(ITIMER_REAL, &periodo, NULL);
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin) {
+    return (GPIOx->IDR & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState) {
+    if (PinState != GPIO_PIN_RESET) {
+        GPIOx->BSRR = GPIO_Pin;
+        __atomic_fetch_or(&GPIOx->ODR, GPIO_Pin, __ATOMIC_RELEASE);
+    } else {
+        GPIOx->BSRR = (uint32_t)GPIO_Pin << 16;
+        __atomic_fetch_and(&GPIOx->ODR, ~(uint32_t)GPIO_Pin, __ATOMIC_RELEASE);
+    }
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin) {
+    __atomic_fetch_xor(&GPIOx->ODR, GPIO_Pin, __ATOMIC_RELEASE);
+}
+
+void HAL_Host_WriteBSRR(GPIO_TypeDef * GPIOx, uint32_t valor) {
+    uint32_t set = valor & 0xFFFFu;
+    uint32_t reset = valor >> 16;
+    uint32_t actual = __atomic_load_n(&GPIOx->ODR, __ATOMIC_RELAXED);
+
+    GPIOx->BSRR = valor;
+    while (!__atomic_compare_exchange_n(&GPIOx->ODR, &actual, (actual & ~reset) | set, false,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+    }
+}
+
+__attribute__((weak)) void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+    (void)GPIO_Pin;
+}
+
+void HAL_Host_DisableIrq(void) {
+    sigprocmask(SIG_BLOCK, &interrupciones, NULL);
+}
+
+void HAL_Host_EnableIrq(void) {
+    sigprocmask(SIG_UNBLOCK, &interrupciones, NULL);
+}
+
+void HAL_Host_WaitForInterrupt(void) {
+    sigset_t espera;
+
+    sigprocmask(SIG_BLOCK, NULL, &espera);
+    sigdelset(&espera, SIGUSR1);
+    sigdelset(&espera, SIGALRM);
+    /* Desbloquea y espera de forma atómica: una interrupción pendiente despierta enseguida */
+    sigsuspend(&espera);
+}
+
+#endif /* HAL_HOST || TEST */
+
+/* === End of documentation ==================================================================== */
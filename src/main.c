@@ -21,34 +21,122 @@ SPDX-License-Identifier: MIT
 
 /**
  * @file main.c
- * @brief -----
+ * @brief Lazo principal: antirrebote del botón de usuario con el LED de depuración
+ * @details El antirrebote trabaja en modo interrupción y corre como tarea periódica del
+ * planificador solo mientras hay un antirrebote en curso: el flanco del botón la activa y ella se
+ * suspende al volver al reposo. El LED se actualiza en una tarea esporádica activada por los
+ * eventos confirmados. Sin tareas activas el planificador detiene el SysTick y el procesador duerme
+ * hasta el próximo flanco.
  */
 
 /* === Headers files inclusions =============================================================== */
 
+#include "main.h"
 #include "API_debounce.h"
+#include "API_scheduler.h"
 
 /* === Macros definitions ====================================================================== */
+/** @brief Período de muestreo del antirrebote mientras está activo, en milisegundos */
+#define MAIN_MUESTREO_MS 5
+/** @brief Plazo para reflejar un evento en el LED, en milisegundos */
+#define MAIN_LED_PLAZO_MS 10
+
+/** @brief Prioridades de las tareas, 0 es la más alta */
+enum {
+    PRIORIDAD_ANTIRREBOTE,
+    PRIORIDAD_LED,
+};
 
 /* === Private data type declarations ========================================================== */
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
 
+/**
+ * @brief Tarea periódica del antirrebote, se suspende cuando no queda nada por confirmar
+ */
+static schedulerResult_t muestrear(schedulerTask_t * tarea, void * contexto);
+
+/**
+ * @brief Tarea esporádica que escribe en el LED el último estado confirmado del botón
+ */
+static schedulerResult_t actualizarLed(schedulerTask_t * tarea, void * contexto);
+
+/**
+ * @brief Manejador de los eventos confirmados: guarda el estado y activa la tarea del LED
+ */
+static void pedirLed(const event_t * event, void * contexto);
+
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
 
+/** @brief Tarea del antirrebote */
+static schedulerTask_t tareaAntirrebote;
+/** @brief Tarea del LED */
+static schedulerTask_t tareaLed;
+/** @brief Estado que debe mostrar el LED */
+static volatile bool ledEncendido;
+
 /* === Private function implementation ========================================================= */
 
+static schedulerResult_t muestrear(schedulerTask_t * tarea, void * contexto) {
+    (void)contexto;
+    debounceFSM_Update();
+    if (!debounce_AnyActive()) {
+        scheduler_Suspend(tarea);
+    }
+    return SCHEDULER_DONE;
+}
+
+static schedulerResult_t actualizarLed(schedulerTask_t * tarea, void * contexto) {
+    (void)tarea;
+    (void)contexto;
+    IO_Write(IO_LED_DEBUG, ledEncendido);
+    return SCHEDULER_DONE;
+}
+
+static void pedirLed(const event_t * event, void * contexto) {
+    (void)contexto;
+    ledEncendido = (event->edge == EVENT_PRESSED);
+    scheduler_Activate(&tareaLed);
+}
+
 /* === Public function implementation ========================================================== */
 
+/**
+ * @brief Callback de la interrupción por cambio de pin
+ * @param GPIO_Pin Pin que cambió
+ */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+    if (GPIO_Pin == BUTTON_PIN) {
+        debounce_NotifyDevice(IO_BUTTON_USER);
+        scheduler_Activate(&tareaAntirrebote);
+    }
+}
+
 /**
  * @brief Función principal
  * */
 int main(void) {
 
-    return 0;
+    if (HAL_Init() != HAL_OK) {
+        return 1;
+    }
+    IO_Init();
+    debounceFSM_Init();
+    debounceFSM_SetMode(DEBOUNCE_MODE_INTERRUPT);
+    debounceFSM_Subscribe(pedirLed, pedirLed, NULL);
+
+    scheduler_Init();
+    if (!scheduler_Add(&tareaAntirrebote, muestrear, NULL, DELAY_MS(MAIN_MUESTREO_MS), 0,
+                       PRIORIDAD_ANTIRREBOTE) ||
+        !scheduler_Add(&tareaLed, actualizarLed, NULL, 0, DELAY_MS(MAIN_LED_PLAZO_MS),
+                       PRIORIDAD_LED)) {
+        return 1;
+    }
+
+    scheduler_Loop();
 }
 
 /* === End of documentation ==================================================================== */
@@ -0,0 +1,185 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file test_API_IO.c
+ * @brief Pruebas unitarias de la copia de salidas, la escritura agrupada y los accesos en línea de
+ * API_IO
+ * @details Se usa la HAL emulada: BSRR se carga con un valor imposible antes de cada operación
+ * para saber si hubo o no un acceso al puerto.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "API_IO.h"
+#include "API_IO_inline.h"
+#include "hal_host.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Valor que ninguna escritura de API_IO deja en BSRR */
+#define BSRR_SIN_ESCRIBIR 0xFFFFFFFFu
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+static IO_Snapshot_t ultimaLectura;
+static int lecturas;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+//! * @brief Marca los registros BSRR de los puertos usados como no escritos.
+void marcarPuertos(void) {
+    BUTTON_PORT->BSRR = BSRR_SIN_ESCRIBIR;
+    LED_PORT->BSRR = BSRR_SIN_ESCRIBIR;
+}
+
+//! * @brief Función de lectura que guarda la última lectura informada.
+void registrarLectura(IO_Snapshot_t snapshot) {
+    ultimaLectura = snapshot;
+    lecturas++;
+}
+
+void setUp(void) {
+    BUTTON_PORT->ODR = 0;
+    LED_PORT->ODR = LED_PIN;
+    IO_Init();
+    marcarPuertos();
+}
+
+//! * @test 1. IO_Init escribe el LED apagado aunque no se conozca el estado previo del pin.
+void test_init_apaga_el_led(void) {
+    TEST_ASSERT_EQUAL_HEX32(0, LED_PORT->ODR & LED_PIN);
+}
+
+//! * @test 2. Escribir el estado que ya tiene la salida no accede al puerto.
+void test_escritura_redundante_no_accede_al_puerto(void) {
+    TEST_ASSERT_EQUAL(IO_OK, IO_Write(IO_LED_DEBUG, false));
+    TEST_ASSERT_EQUAL_HEX32(BSRR_SIN_ESCRIBIR, LED_PORT->BSRR);
+
+    TEST_ASSERT_EQUAL(IO_OK, IO_Write(IO_LED_DEBUG, true));
+    TEST_ASSERT_EQUAL_HEX32(LED_PIN, LED_PORT->BSRR);
+    TEST_ASSERT_EQUAL_HEX32(LED_PIN, LED_PORT->ODR & LED_PIN);
+
+    marcarPuertos();
+    TEST_ASSERT_EQUAL(IO_OK, IO_Write(IO_LED_DEBUG, true));
+    TEST_ASSERT_EQUAL_HEX32(BSRR_SIN_ESCRIBIR, LED_PORT->BSRR);
+}
+
+//! * @test 3. IO_Toggle mantiene la copia de salidas al día.
+void test_toggle_actualiza_la_copia(void) {
+    IO_Toggle(IO_LED_DEBUG);
+    TEST_ASSERT_EQUAL_HEX32(LED_PIN, LED_PORT->ODR & LED_PIN);
+
+    marcarPuertos();
+    IO_Write(IO_LED_DEBUG, true);
+    TEST_ASSERT_EQUAL_HEX32(BSRR_SIN_ESCRIBIR, LED_PORT->BSRR);
+
+    IO_Write(IO_LED_DEBUG, false);
+    TEST_ASSERT_EQUAL_HEX32((uint32_t)LED_PIN << 16, LED_PORT->BSRR);
+}
+
+//! * @test 4. IO_Flush escribe una sola vez cada puerto con cambios y solo los pines que cambian.
+void test_flush_escribe_una_vez_por_puerto(void) {
+    TEST_ASSERT_EQUAL(IO_OK, IO_WriteMask(IO_MASK(IO_LED_DEBUG) | IO_MASK(IO_BUTTON_USER), 0));
+    TEST_ASSERT_EQUAL_HEX32(BSRR_SIN_ESCRIBIR, LED_PORT->BSRR);
+
+    TEST_ASSERT_EQUAL(2, IO_Flush());
+    TEST_ASSERT_EQUAL_HEX32(LED_PIN, LED_PORT->BSRR);
+    TEST_ASSERT_EQUAL_HEX32(BUTTON_PIN, BUTTON_PORT->BSRR);
+    TEST_ASSERT_EQUAL_HEX32(LED_PIN, LED_PORT->ODR & LED_PIN);
+    TEST_ASSERT_EQUAL_HEX32(BUTTON_PIN, BUTTON_PORT->ODR & BUTTON_PIN);
+
+    marcarPuertos();
+    IO_WriteMask(IO_MASK(IO_LED_DEBUG), IO_MASK(IO_BUTTON_USER));
+    TEST_ASSERT_EQUAL(1, IO_Flush());
+    TEST_ASSERT_EQUAL_HEX32(BSRR_SIN_ESCRIBIR, LED_PORT->BSRR);
+    TEST_ASSERT_EQUAL_HEX32((uint32_t)BUTTON_PIN << 16, BUTTON_PORT->BSRR);
+    TEST_ASSERT_EQUAL_HEX32(0, BUTTON_PORT->ODR & BUTTON_PIN);
+
+    marcarPuertos();
+    TEST_ASSERT_EQUAL(0, IO_Flush());
+    TEST_ASSERT_EQUAL_HEX32(BSRR_SIN_ESCRIBIR, BUTTON_PORT->BSRR);
+}
+
+//! * @test 5. Los cambios agendados se acumulan y el último pedido de cada dispositivo gana.
+void test_ultimo_cambio_agendado_gana(void) {
+    IO_WriteMask(IO_MASK(IO_LED_DEBUG), 0);
+    IO_WriteMask(0, IO_MASK(IO_LED_DEBUG));
+    TEST_ASSERT_EQUAL(0, IO_Flush());
+
+    IO_WriteMask(IO_MASK(IO_LED_DEBUG), 0);
+    IO_Write(IO_LED_DEBUG, false);
+    TEST_ASSERT_EQUAL(0, IO_Flush());
+    TEST_ASSERT_EQUAL_HEX32(BSRR_SIN_ESCRIBIR, LED_PORT->BSRR);
+}
+
+//! * @test 6. IO_WriteMask rechaza dispositivos inexistentes y pedidos contradictorios.
+void test_write_mask_valida_los_argumentos(void) {
+    TEST_ASSERT_EQUAL(IO_INVALID_DEVICE, IO_WriteMask(IO_MASK(IO_DEVICE_COUNT), 0));
+    TEST_ASSERT_EQUAL(IO_INVALID_DEVICE, IO_WriteMask(0, IO_MASK(IO_DEVICE_COUNT)));
+    TEST_ASSERT_EQUAL(IO_ERROR, IO_WriteMask(IO_MASK(IO_LED_DEBUG), IO_MASK(IO_LED_DEBUG)));
+    TEST_ASSERT_EQUAL(0, IO_Flush());
+}
+
+//! * @test 7. Los accesos en línea usan el pin de la tabla y comparten la copia de salidas.
+void test_accesos_en_linea_comparten_la_copia(void) {
+    BUTTON_PORT->IDR = BUTTON_PIN;
+    TEST_ASSERT_TRUE(IO_BUTTON_USER_Read());
+    TEST_ASSERT_TRUE(IO_ReadFast(IO_BUTTON_USER));
+    BUTTON_PORT->IDR = 0;
+    TEST_ASSERT_FALSE(IO_BUTTON_USER_Read());
+
+    IO_LED_DEBUG_Write(false);
+    TEST_ASSERT_EQUAL_HEX32(BSRR_SIN_ESCRIBIR, LED_PORT->BSRR);
+
+    IO_LED_DEBUG_Toggle();
+    TEST_ASSERT_EQUAL_HEX32(LED_PIN, LED_PORT->ODR & LED_PIN);
+
+    marcarPuertos();
+    IO_Write(IO_LED_DEBUG, true);
+    IO_WriteFast(IO_LED_DEBUG, true);
+    TEST_ASSERT_EQUAL_HEX32(BSRR_SIN_ESCRIBIR, LED_PORT->BSRR);
+}
+
+//! * @test 8. Las lecturas en línea se informan a la función de lectura instalada.
+void test_lectura_en_linea_informa_a_la_funcion_de_lectura(void) {
+    lecturas = 0;
+    BUTTON_PORT->IDR = BUTTON_PIN;
+    IO_SetReadHook(registrarLectura);
+
+    IO_BUTTON_USER_Read();
+    IO_SetReadHook(NULL);
+    IO_BUTTON_USER_Read();
+
+    TEST_ASSERT_EQUAL(1, lecturas);
+    TEST_ASSERT_TRUE(IO_SNAPSHOT_STATE(ultimaLectura, IO_BUTTON_USER));
+    TEST_ASSERT_FALSE(IO_ReadFast(IO_DEVICE_COUNT));
+}
+
+/* === End of documentation ==================================================================== */
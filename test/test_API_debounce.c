@@ -29,11 +29,17 @@ SPDX-License-Identifier: MIT
 #include "mock_API_delay.h"
 #include "mock_API_IO.h"
 #include "API_debounce.h"
+#include "API_eventQueue.h"
+
+#include <pthread.h>
+#include <time.h>
 
 /* === Macros definitions ====================================================================== */
 #define MAX_LECTURAS              10
 #define INDICE_INICIAL_LECTURA    0
 #define CONTEO_INICIAL_ESCRITURAS 0
+#define ESPERA_CORTA              DELAY_MS(20)
+#define ESPERA_LARGA              DELAY_MS(2000)
 
 /* === Private data type declarations ========================================================== */
 
@@ -43,6 +49,12 @@ static bool ultimo_estado_led = false;
 
 static bool lecturas_boton[MAX_LECTURAS];
 static int indice_lectura = INDICE_INICIAL_LECTURA;
+static int consultas_retardo;
+
+static event_t eventos_recibidos[MAX_LECTURAS];
+static int cantidad_recibidos;
+static void * contexto_recibido;
+static IO_Snapshot_t entradas_despertadas;
 
 /* === Private function declarations =========================================================== */
 
@@ -88,16 +100,56 @@ bool IO_Read_Fake(IO_Device_t device, bool * state) {
     }
 }
 
+//! * @brief Cuenta las consultas al retardo, que los algoritmos sin tiempo no deben hacer.
+bool_t delayReadAt_Contar(delay_t * delay, tick_t now, int cmock_num_calls) {
+    consultas_retardo++;
+    return true;
+}
+
+//! * @brief Simula un retardo que vence recién en la quinta consulta.
+bool_t delayReadAt_VenceEnQuintaLlamada(delay_t * delay, tick_t now, int cmock_num_calls) {
+    return cmock_num_calls >= 4;
+}
+
+//! * @brief Manejador suscripto que guarda los eventos entregados y el contexto recibido.
+void Manejador_Registrar(const event_t * event, void * contexto) {
+    TEST_ASSERT_LESS_THAN(MAX_LECTURAS, cantidad_recibidos);
+    eventos_recibidos[cantidad_recibidos++] = *event;
+    contexto_recibido = contexto;
+}
+
+//! * @brief Milisegundos de un reloj monotónico, para medir las esperas bloqueantes.
+uint64_t milisegundos(void) {
+    struct timespec ahora;
+
+    clock_gettime(CLOCK_MONOTONIC, &ahora);
+    return (uint64_t)ahora.tv_sec * 1000u + (uint64_t)ahora.tv_nsec / 1000000u;
+}
+
+//! * @brief Hilo que espera un evento del botón de usuario con un timeout largo.
+void * esperar_boton(void * argumento) {
+    (void)argumento;
+    entradas_despertadas = debounce_WaitEvent(ESPERA_LARGA, IO_MASK(IO_BUTTON_USER));
+    return NULL;
+}
+
 void setUp(void) {
     conteo_escrituras = CONTEO_INICIAL_ESCRITURAS;
     ultimo_estado_led = false;
     indice_lectura = INDICE_INICIAL_LECTURA;
+    consultas_retardo = 0;
+    cantidad_recibidos = 0;
+    contexto_recibido = NULL;
+
+    entradas_despertadas = 0;
+    debounce_WaitEvent(0, ~(IO_Snapshot_t)0);
 
     IO_Write_StubWithCallback(IO_Write_Callback);
     IO_Read_StubWithCallback(IO_Read_Fake);
 
     delayInit_Ignore();
-    delayRead_IgnoreAndReturn(true);
+    delayReadAt_IgnoreAndReturn(true);
+    delayGetTick_IgnoreAndReturn(0);
 }
 
 //! * @test 1. El LED se enciende correctamente al detectar una pulsación estable del botón.
@@ -207,4 +259,385 @@ void test_LED_solo_se_activa_una_vez_por_pulsacion(void) {
     TEST_ASSERT_FALSE(ultimo_estado_led);
 }
 
+//! * @test 6. En modo anticipado el LED se enciende con la primera lectura activa, sin esperar
+//! *         el retardo de antirrebote.
+// Llamadas  Entrada  Acción esperada
+// 1         true     BUTTON_FALLING (enciende LED, inicia bloqueo)
+void test_LED_anticipado_enciende_en_el_primer_flanco(void) {
+
+    bool secuencia[] = {true};
+
+    simular_lecturas(secuencia, 1);
+
+    TEST_ASSERT_TRUE(debounceFSM_InitWith(DEBOUNCE_ALG_EAGER));
+    realizar_actualizaciones(1);
+
+    TEST_ASSERT_EQUAL(2, conteo_escrituras);
+    TEST_ASSERT_TRUE(ultimo_estado_led);
+}
+
+//! * @test 7. En modo anticipado la entrada no se lee durante el bloqueo, así los rebotes
+//! *         posteriores a la presión no apagan el LED.
+// Llamadas  Entrada  Acción esperada
+// 1         true     BUTTON_FALLING (enciende LED, inicia bloqueo)
+// 2..4      -        bloqueo sin vencer, no se lee la entrada
+// 5         -        vence el bloqueo, BUTTON_DOWN
+// 6         true     BUTTON_DOWN
+void test_LED_anticipado_ignora_rebotes_durante_bloqueo(void) {
+
+    bool secuencia[] = {true, true};
+
+    simular_lecturas(secuencia, 2);
+    delayReadAt_StubWithCallback(delayReadAt_VenceEnQuintaLlamada);
+
+    debounceFSM_InitWith(DEBOUNCE_ALG_EAGER);
+    realizar_actualizaciones(4);
+    TEST_ASSERT_EQUAL(1, indice_lectura);
+
+    realizar_actualizaciones(2);
+    TEST_ASSERT_EQUAL(2, indice_lectura);
+    TEST_ASSERT_EQUAL(2, conteo_escrituras);
+    TEST_ASSERT_TRUE(ultimo_estado_led);
+}
+
+//! * @test 8. Con filtro de ruido de dos muestras un pico aislado no enciende el LED y dos
+//! *         lecturas activas seguidas sí.
+// Llamadas  Entrada  Acción esperada
+// 1         true     BUTTON_UP (primera coincidencia)
+// 2         false    BUTTON_UP (pico descartado)
+// 3         true     BUTTON_UP (primera coincidencia)
+// 4         true     BUTTON_FALLING (enciende LED)
+void test_LED_anticipado_descarta_picos_de_ruido(void) {
+
+    bool secuencia[] = {true, false, true, true};
+
+    simular_lecturas(secuencia, 4);
+
+    debounceFSM_InitWith(DEBOUNCE_ALG_EAGER);
+    TEST_ASSERT_TRUE(debounceFSM_SetEagerSamples(2));
+    realizar_actualizaciones(3);
+    TEST_ASSERT_EQUAL(1, conteo_escrituras);
+    TEST_ASSERT_FALSE(ultimo_estado_led);
+
+    realizar_actualizaciones(1);
+    TEST_ASSERT_EQUAL(2, conteo_escrituras);
+    TEST_ASSERT_TRUE(ultimo_estado_led);
+}
+
+//! * @test 9. Una instancia propia reporta sus eventos sin afectar al LED de depuración.
+// Llamadas  Entrada  Acción esperada
+// 1         true     BUTTON_FALLING
+// 2         true     BUTTON_DOWN (flag de presión)
+// 3         false    BUTTON_RISING
+// 4         false    BUTTON_UP (flag de liberación)
+void test_instancia_reporta_eventos_sin_escribir_LED(void) {
+
+    debounce_t boton;
+    bool secuencia[] = {true, true, false, false};
+
+    simular_lecturas(secuencia, 4);
+
+    debounce_Init(&boton, IO_BUTTON_USER);
+
+    debounce_Update(&boton);
+    debounce_Update(&boton);
+
+    TEST_ASSERT_TRUE(debounce_ReadPressed(&boton));
+    TEST_ASSERT_FALSE(debounce_ReadPressed(&boton));
+
+    debounce_Update(&boton);
+    debounce_Update(&boton);
+
+    TEST_ASSERT_TRUE(debounce_ReadReleased(&boton));
+    TEST_ASSERT_EQUAL(0, conteo_escrituras);
+}
+
+//! * @test 10. Una instancia actualizada desde una lectura agrupada no llama a IO_Read.
+void test_instancia_usa_lectura_agrupada(void) {
+
+    debounce_t boton;
+    IO_Snapshot_t presionado = 1u << IO_BUTTON_USER;
+
+    IO_Read_StubWithCallback(NULL);
+
+    debounce_Init(&boton, IO_BUTTON_USER);
+
+    debounce_UpdateSnapshot(&boton, presionado);
+    debounce_UpdateSnapshot(&boton, presionado);
+
+    TEST_ASSERT_TRUE(debounce_ReadPressed(&boton));
+}
+
+//! * @test 11. Una secuencia presión-liberación-presión se conserva completa y en orden.
+// Llamadas  Entrada  Acción esperada
+// 1         true     BUTTON_FALLING
+// 2         true     BUTTON_DOWN (evento de presión)
+// 3         false    BUTTON_RISING
+// 4         false    BUTTON_UP (evento de liberación)
+// 5         true     BUTTON_FALLING
+// 6         true     BUTTON_DOWN (evento de presión)
+void test_eventos_se_conservan_en_orden(void) {
+
+    event_t evento;
+    bool secuencia[] = {true, true, false, false, true, true};
+
+    while (debounce_ReadEvent(&evento)) {
+    }
+
+    simular_lecturas(secuencia, 6);
+
+    debounceFSM_Init();
+
+    realizar_actualizaciones(6);
+
+    TEST_ASSERT_TRUE(debounce_ReadEvent(&evento));
+    TEST_ASSERT_EQUAL(EVENT_PRESSED, evento.edge);
+    TEST_ASSERT_EQUAL(IO_BUTTON_USER, evento.device);
+    TEST_ASSERT_TRUE(debounce_ReadEvent(&evento));
+    TEST_ASSERT_EQUAL(EVENT_RELEASED, evento.edge);
+    TEST_ASSERT_TRUE(debounce_ReadEvent(&evento));
+    TEST_ASSERT_EQUAL(EVENT_PRESSED, evento.edge);
+    TEST_ASSERT_FALSE(debounce_ReadEvent(&evento));
+}
+
+//! * @test 12. En modo interrupción la FSM no lee el botón mientras no se notifique un flanco.
+// Llamadas  Entrada  Lecturas en polling  Lecturas en interrupción
+// 1..10     false    10                   1 (muestreo inicial al cambiar de modo)
+void test_modo_interrupcion_no_lee_sin_flancos(void) {
+
+    bool secuencia[] = {false};
+
+    simular_lecturas(secuencia, 1);
+
+    debounceFSM_Init();
+    realizar_actualizaciones(10);
+    TEST_ASSERT_EQUAL(10, indice_lectura);
+
+    indice_lectura = INDICE_INICIAL_LECTURA;
+    debounceFSM_SetMode(DEBOUNCE_MODE_INTERRUPT);
+    realizar_actualizaciones(10);
+    TEST_ASSERT_EQUAL(1, indice_lectura);
+    TEST_ASSERT_FALSE(debounce_AnyActive());
+}
+
+//! * @test 13. En modo interrupción un flanco notificado inicia el antirrebote y enciende el LED.
+// Llamadas  Entrada  Acción esperada
+// 1         false    BUTTON_UP (muestreo inicial)
+// 2..4      -        BUTTON_UP (sin lecturas)
+// flanco notificado por interrupción
+// 5         true     BUTTON_FALLING
+// 6         true     BUTTON_DOWN (enciende LED)
+void test_modo_interrupcion_detecta_flanco_notificado(void) {
+
+    bool secuencia[] = {false, true, true};
+
+    simular_lecturas(secuencia, 3);
+
+    debounceFSM_Init();
+    debounceFSM_SetMode(DEBOUNCE_MODE_INTERRUPT);
+    realizar_actualizaciones(4);
+
+    debounce_NotifyDevice(IO_BUTTON_USER);
+    TEST_ASSERT_TRUE(debounce_AnyActive());
+    realizar_actualizaciones(2);
+
+    TEST_ASSERT_EQUAL(3, indice_lectura);
+    TEST_ASSERT_TRUE(ultimo_estado_led);
+}
+
+//! * @test 14. Una instancia con un estado fuera de la tabla de transiciones vuelve a BUTTON_UP
+//! *          sin leer la entrada ni generar eventos.
+void test_estado_invalido_vuelve_a_reposo(void) {
+    debounce_t boton;
+    bool secuencia[] = {true};
+
+    simular_lecturas(secuencia, 1);
+
+    debounce_Init(&boton, IO_BUTTON_USER);
+    boton.estado = (debounceState_t)(BUTTON_RISING + 1);
+    debounce_Update(&boton);
+
+    TEST_ASSERT_EQUAL(BUTTON_UP, boton.estado);
+    TEST_ASSERT_EQUAL(INDICE_INICIAL_LECTURA, indice_lectura);
+    TEST_ASSERT_FALSE(debounce_ReadPressed(&boton));
+}
+
+//! * @test 15. El integrador confirma la presión aunque haya una muestra contraria en el medio,
+//! *          sin usar el retardo.
+// Llamadas  Entrada  Integrador
+// 1..7      true     1..7 (BUTTON_FALLING)
+// 8         false    6
+// 9..10     true     7..8 (BUTTON_DOWN)
+void test_integrador_tolera_una_muestra_contraria(void) {
+    debounce_t boton;
+    bool secuencia[] = {true, true, true, true, true, true, true, false, true, true};
+
+    simular_lecturas(secuencia, 10);
+    delayReadAt_StubWithCallback(delayReadAt_Contar);
+
+    TEST_ASSERT_TRUE(debounce_InitWith(&boton, IO_BUTTON_USER, DEBOUNCE_ALG_INTEGRATOR));
+    for (int i = 0; i < 9; i++) {
+        debounce_Update(&boton);
+    }
+    TEST_ASSERT_EQUAL(BUTTON_FALLING, boton.estado);
+    debounce_Update(&boton);
+
+    TEST_ASSERT_EQUAL(BUTTON_DOWN, boton.estado);
+    TEST_ASSERT_TRUE(debounce_ReadPressed(&boton));
+    TEST_ASSERT_EQUAL(0, consultas_retardo);
+}
+
+//! * @test 16. El registro de desplazamiento exige DEBOUNCE_SHIFT_BITS muestras iguales seguidas:
+//! *          la misma secuencia que acepta el integrador no confirma la presión.
+void test_registro_exige_muestras_consecutivas(void) {
+    debounce_t boton;
+    bool secuencia[] = {true, true, true, true, true, true, true, false, true, true};
+
+    simular_lecturas(secuencia, 10);
+    delayReadAt_StubWithCallback(delayReadAt_Contar);
+
+    TEST_ASSERT_TRUE(debounce_InitWith(&boton, IO_BUTTON_USER, DEBOUNCE_ALG_SHIFT));
+    for (int i = 0; i < 10; i++) {
+        debounce_Update(&boton);
+    }
+
+    TEST_ASSERT_EQUAL(BUTTON_FALLING, boton.estado);
+    TEST_ASSERT_FALSE(debounce_ReadPressed(&boton));
+    TEST_ASSERT_EQUAL(0, consultas_retardo);
+}
+
+//! * @test 17. Un algoritmo inexistente se rechaza al inicializar.
+void test_algoritmo_invalido(void) {
+    debounce_t boton;
+
+    TEST_ASSERT_FALSE(debounce_InitWith(&boton, IO_BUTTON_USER, DEBOUNCE_ALG_COUNT));
+    TEST_ASSERT_EQUAL(0, debounce_AlgorithmStateSize(DEBOUNCE_ALG_COUNT));
+}
+
+//! * @test 18. Los manejadores suscriptos reciben cada evento en la misma actualización que lo
+//! *          confirma, con el dispositivo y el contexto registrados.
+// Llamadas  Entrada  Acción esperada
+// 1         true     BUTTON_FALLING
+// 2         true     BUTTON_DOWN (manejador de presión)
+// 3         false    BUTTON_RISING
+// 4         false    BUTTON_UP (manejador de liberación)
+void test_suscriptor_recibe_eventos_confirmados(void) {
+    debounce_t boton;
+    int contexto;
+    bool secuencia[] = {true, true, false, false};
+
+    simular_lecturas(secuencia, 4);
+
+    debounce_Init(&boton, IO_BUTTON_USER);
+    TEST_ASSERT_TRUE(
+        debounce_Subscribe(&boton, Manejador_Registrar, Manejador_Registrar, &contexto));
+
+    debounce_UpdateAt(&boton, 10);
+    debounce_UpdateAt(&boton, 50);
+    TEST_ASSERT_EQUAL(1, cantidad_recibidos);
+    TEST_ASSERT_EQUAL(EVENT_PRESSED, eventos_recibidos[0].edge);
+    TEST_ASSERT_EQUAL(IO_BUTTON_USER, eventos_recibidos[0].device);
+    TEST_ASSERT_EQUAL(50, eventos_recibidos[0].tick);
+    TEST_ASSERT_EQUAL_PTR(&contexto, contexto_recibido);
+
+    debounce_UpdateAt(&boton, 60);
+    debounce_UpdateAt(&boton, 100);
+    TEST_ASSERT_EQUAL(2, cantidad_recibidos);
+    TEST_ASSERT_EQUAL(EVENT_RELEASED, eventos_recibidos[1].edge);
+    TEST_ASSERT_EQUAL(0, conteo_escrituras);
+
+    debounce_Unsubscribe(&boton);
+}
+
+//! * @test 19. Un suscriptor propio reemplaza al LED de depuración en la FSM por defecto.
+// Llamadas  Entrada  Acción esperada
+// 1         true     BUTTON_FALLING
+// 2         true     BUTTON_DOWN (manejador de presión, el LED no cambia)
+void test_suscriptor_reemplaza_LED_por_defecto(void) {
+    bool secuencia[] = {true, true};
+
+    simular_lecturas(secuencia, 2);
+
+    debounceFSM_Init();
+    TEST_ASSERT_TRUE(debounceFSM_Subscribe(Manejador_Registrar, NULL, NULL));
+    realizar_actualizaciones(2);
+
+    TEST_ASSERT_EQUAL(1, cantidad_recibidos);
+    TEST_ASSERT_EQUAL(1, conteo_escrituras);
+    TEST_ASSERT_FALSE(ultimo_estado_led);
+    TEST_ASSERT_TRUE(readKeyDesc());
+}
+
+//! * @test 20. La tabla de suscriptores admite DEBOUNCE_MAX_SUSCRIPTORES instancias y quitar una
+//! *          suscripción libera su entrada.
+void test_tabla_de_suscriptores_llena(void) {
+    debounce_t botones[DEBOUNCE_MAX_SUSCRIPTORES];
+
+    debounceFSM_Init();
+    for (int i = 0; i < DEBOUNCE_MAX_SUSCRIPTORES; i++) {
+        debounce_Init(&botones[i], IO_BUTTON_USER);
+    }
+    for (int i = 0; i < DEBOUNCE_MAX_SUSCRIPTORES - 1; i++) {
+        TEST_ASSERT_TRUE(debounce_Subscribe(&botones[i], Manejador_Registrar, NULL, NULL));
+    }
+    TEST_ASSERT_FALSE(debounce_Subscribe(&botones[DEBOUNCE_MAX_SUSCRIPTORES - 1],
+                                         Manejador_Registrar, NULL, NULL));
+
+    debounce_Unsubscribe(&botones[0]);
+    TEST_ASSERT_TRUE(debounce_Subscribe(&botones[DEBOUNCE_MAX_SUSCRIPTORES - 1],
+                                        Manejador_Registrar, NULL, NULL));
+
+    for (int i = 0; i < DEBOUNCE_MAX_SUSCRIPTORES; i++) {
+        debounce_Unsubscribe(&botones[i]);
+    }
+}
+
+//! * @test 21. La espera sin timeout solo informa las entradas pedidas y borra su aviso.
+void test_espera_informa_solo_las_entradas_pedidas(void) {
+    debounce_t boton;
+    bool secuencia[] = {true, true};
+
+    simular_lecturas(secuencia, 2);
+
+    debounce_Init(&boton, IO_BUTTON_USER);
+    TEST_ASSERT_EQUAL(0, debounce_WaitEvent(0, IO_MASK(IO_BUTTON_USER)));
+    debounce_Update(&boton);
+    debounce_Update(&boton);
+
+    TEST_ASSERT_EQUAL(0, debounce_WaitEvent(0, IO_MASK(IO_LED_DEBUG)));
+    TEST_ASSERT_EQUAL(IO_MASK(IO_BUTTON_USER),
+                      debounce_WaitEvent(0, IO_MASK(IO_BUTTON_USER) | IO_MASK(IO_LED_DEBUG)));
+    TEST_ASSERT_EQUAL(0, debounce_WaitEvent(0, IO_MASK(IO_BUTTON_USER)));
+    TEST_ASSERT_TRUE(debounce_ReadPressed(&boton));
+}
+
+//! * @test 22. Sin eventos la espera vuelve con 0 cuando vence el timeout.
+void test_espera_vence_sin_eventos(void) {
+    uint64_t inicio = milisegundos();
+
+    TEST_ASSERT_EQUAL(0, debounce_WaitEvent(ESPERA_CORTA, IO_MASK(IO_BUTTON_USER)));
+    TEST_ASSERT_GREATER_OR_EQUAL(ESPERA_CORTA * 1000u / DELAY_TICK_HZ, milisegundos() - inicio);
+}
+
+//! * @test 23. Un hilo bloqueado despierta cuando otro confirma una presión, con la bandera ya
+//! *          activa.
+void test_espera_despierta_con_evento_de_otro_hilo(void) {
+    const struct timespec pausa = {0, 10000000};
+    debounce_t boton;
+    pthread_t hilo;
+    bool secuencia[] = {true, true};
+
+    simular_lecturas(secuencia, 2);
+    debounce_Init(&boton, IO_BUTTON_USER);
+
+    TEST_ASSERT_EQUAL(0, pthread_create(&hilo, NULL, esperar_boton, NULL));
+    nanosleep(&pausa, NULL);
+    debounce_Update(&boton);
+    debounce_Update(&boton);
+    pthread_join(hilo, NULL);
+
+    TEST_ASSERT_EQUAL(IO_MASK(IO_BUTTON_USER), entradas_despertadas);
+    TEST_ASSERT_TRUE(debounce_ReadPressed(&boton));
+}
+
 /* === End of documentation ==================================================================== */
@@ -0,0 +1,178 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file test_API_debounceAdaptive.c
+ * @brief Pruebas del algoritmo de ventana adaptativa con trazas sintéticas de rebotes
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "mock_API_IO.h"
+#include "API_debounce.h"
+#include "API_delay.h"
+#include "API_eventQueue.h"
+#include "API_trace.h"
+
+/* === Macros definitions ====================================================================== */
+#define CAPACIDAD        4096
+#define BOTON            ((IO_Snapshot_t)1u << IO_BUTTON_USER)
+/** @brief Ticks entre flancos de una pulsación y hasta la siguiente */
+#define TIEMPO_ESTABLE   200
+/** @brief Rebote de un pulsador en buen estado */
+#define REBOTE_CORTO     2
+/** @brief Rebote de un pulsador gastado */
+#define REBOTE_LARGO     30
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+static uint8_t buffer[CAPACIDAD];
+static trace_t traza;
+static traceReader_t lector;
+static debounce_t boton;
+static tick_t tickTraza;
+static uint32_t presiones;
+static uint32_t liberaciones;
+static eventEdge_t ultimoFlanco;
+static bool alternados;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+//! * @brief Las pruebas usan tiempo virtual, el tick del sistema queda fijo.
+uint32_t HAL_GetTick(void) {
+    return 0;
+}
+
+//! * @brief Cuenta los eventos y verifica que presiones y liberaciones se alternen.
+void contarEvento(const event_t * event, void * ctx) {
+    if (event->edge == ultimoFlanco) {
+        alternados = false;
+    }
+    ultimoFlanco = (eventEdge_t)event->edge;
+    if (event->edge == EVENT_PRESSED) {
+        presiones++;
+    } else {
+        liberaciones++;
+    }
+}
+
+//! * @brief Agrega un flanco que rebota un cambio por tick durante la cantidad de ticks indicada.
+void agregarFlanco(IO_Snapshot_t nivel, tick_t rebote) {
+    for (tick_t t = 0; t < rebote; t++) {
+        trace_Record(&traza, tickTraza + t, (t % 2u == 0) ? nivel : (nivel ^ BOTON));
+    }
+    trace_Record(&traza, tickTraza + rebote, nivel);
+    tickTraza += TIEMPO_ESTABLE;
+}
+
+//! * @brief Genera una traza con pulsaciones completas y la reproduce sobre la instancia.
+void reproducirPulsaciones(int cantidad, tick_t rebote) {
+    trace_InitWriter(&traza, buffer, CAPACIDAD, tickTraza, 0);
+    for (int i = 0; i < cantidad; i++) {
+        agregarFlanco(BOTON, rebote);
+        agregarFlanco(0, rebote);
+    }
+    TEST_ASSERT_TRUE(trace_Finish(&traza, tickTraza));
+    TEST_ASSERT_TRUE(trace_InitReader(&lector, buffer, traza.largo));
+
+    presiones = 0;
+    liberaciones = 0;
+    alternados = true;
+    trace_Replay(&lector, &boton, 1, 1, contarEvento, NULL);
+}
+
+void setUp(void) {
+    event_t descartado;
+
+    while (debounce_ReadEvent(&descartado)) {
+    }
+    tickTraza = 1000;
+    ultimoFlanco = EVENT_RELEASED;
+    TEST_ASSERT_TRUE(debounce_InitWith(&boton, IO_BUTTON_USER, DEBOUNCE_ALG_ADAPTIVE));
+}
+
+//! * @test 1. Con un pulsador que rebota poco la ventana se achica y se confirman todas las
+//! *         pulsaciones.
+void test_ventana_se_achica_con_rebote_corto(void) {
+    TEST_ASSERT_EQUAL(DELAY_MS(TIEMPO_RETARDO), debounce_GetWindow(&boton));
+
+    reproducirPulsaciones(20, REBOTE_CORTO);
+
+    TEST_ASSERT_EQUAL(20, presiones);
+    TEST_ASSERT_EQUAL(20, liberaciones);
+    TEST_ASSERT_TRUE(alternados);
+    TEST_ASSERT_LESS_OR_EQUAL(REBOTE_CORTO + DEBOUNCE_ADAPT_MARGEN + DEBOUNCE_ADAPT_HISTERESIS,
+                              debounce_GetWindow(&boton));
+}
+
+//! * @test 2. Cuando el pulsador se gasta la ventana crece hasta cubrir el rebote y, una vez
+//! *         adaptada, no hay eventos espurios.
+void test_ventana_crece_con_rebote_largo(void) {
+    reproducirPulsaciones(20, REBOTE_CORTO);
+    reproducirPulsaciones(10, REBOTE_LARGO);
+
+    reproducirPulsaciones(10, REBOTE_LARGO);
+    TEST_ASSERT_EQUAL(10, presiones);
+    TEST_ASSERT_EQUAL(10, liberaciones);
+    TEST_ASSERT_TRUE(alternados);
+    TEST_ASSERT_GREATER_THAN(REBOTE_LARGO, debounce_GetWindow(&boton));
+}
+
+//! * @test 3. Rebotes que varían poco entre pulsaciones no cambian la ventana ya adaptada.
+void test_histeresis_evita_oscilar(void) {
+    tick_t ventana;
+
+    reproducirPulsaciones(20, 6);
+    ventana = debounce_GetWindow(&boton);
+    for (int i = 0; i < 5; i++) {
+        reproducirPulsaciones(1, 4);
+        TEST_ASSERT_EQUAL(ventana, debounce_GetWindow(&boton));
+        reproducirPulsaciones(1, 6);
+        TEST_ASSERT_EQUAL(ventana, debounce_GetWindow(&boton));
+    }
+}
+
+//! * @test 4. La ventana respeta los límites configurados aunque el rebote los exceda y al
+//! *         achicarse queda a menos de la histéresis del mínimo.
+void test_limites_de_ventana(void) {
+    TEST_ASSERT_FALSE(debounce_SetAdaptiveBounds(&boton, 0, 10));
+    TEST_ASSERT_FALSE(debounce_SetAdaptiveBounds(&boton, 20, 10));
+    TEST_ASSERT_TRUE(debounce_SetAdaptiveBounds(&boton, 10, 20));
+    TEST_ASSERT_EQUAL(20, debounce_GetWindow(&boton));
+
+    reproducirPulsaciones(5, REBOTE_LARGO);
+    TEST_ASSERT_EQUAL(20, debounce_GetWindow(&boton));
+
+    reproducirPulsaciones(30, 0);
+    TEST_ASSERT_GREATER_OR_EQUAL(10, debounce_GetWindow(&boton));
+    TEST_ASSERT_LESS_THAN(10 + DEBOUNCE_ADAPT_HISTERESIS, debounce_GetWindow(&boton));
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,150 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file test_API_debounceBank.c
+ * @brief Pruebas unitarias para el antirrebote de muchas entradas como estructura de arreglos
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "API_debounceBank.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Entradas del banco de prueba, la última palabra queda incompleta */
+#define ENTRADAS 40
+/** @brief Retardo de antirrebote usado en las pruebas */
+#define RETARDO DELAY_MS(TIEMPO_RETARDO)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+DEBOUNCE_BANK_DEFINE(banco, ENTRADAS);
+static debounceBank_t bank;
+static debounceBank_word_t muestra[DEBOUNCE_BANK_WORDS(ENTRADAS)];
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+//! * @brief Fija el valor crudo de una entrada en la muestra.
+void fijarEntrada(uint32_t entrada, bool presionada) {
+    debounceBank_word_t mascara = (debounceBank_word_t)1u << (entrada % DEBOUNCE_BANK_WIDTH);
+
+    if (presionada) {
+        muestra[entrada / DEBOUNCE_BANK_WIDTH] |= mascara;
+    } else {
+        muestra[entrada / DEBOUNCE_BANK_WIDTH] &= ~mascara;
+    }
+}
+
+void setUp(void) {
+    debounceBank_Init(&bank, ENTRADAS, banco_bits, banco_vencimientos, RETARDO);
+    for (uint32_t i = 0; i < DEBOUNCE_BANK_WORDS(ENTRADAS); i++) {
+        muestra[i] = 0;
+    }
+}
+
+//! * @test 1. Init rechaza un banco sin memoria o sin entradas y deja todas en BUTTON_UP.
+void test_init_valida_y_deja_todo_en_up(void) {
+    TEST_ASSERT_FALSE(debounceBank_Init(&bank, 0, banco_bits, banco_vencimientos, RETARDO));
+    TEST_ASSERT_FALSE(debounceBank_Init(&bank, ENTRADAS, NULL, banco_vencimientos, RETARDO));
+    TEST_ASSERT_FALSE(debounceBank_Init(&bank, ENTRADAS, banco_bits, NULL, RETARDO));
+    TEST_ASSERT_TRUE(debounceBank_Init(&bank, ENTRADAS, banco_bits, banco_vencimientos, RETARDO));
+
+    TEST_ASSERT_EQUAL(BUTTON_UP, debounceBank_State(&bank, 0));
+    TEST_ASSERT_EQUAL(BUTTON_UP, debounceBank_State(&bank, ENTRADAS - 1));
+    TEST_ASSERT_EQUAL(BUTTON_UP, debounceBank_State(&bank, ENTRADAS));
+}
+
+//! * @test 2. La presión pasa por BUTTON_FALLING y se confirma una vez al vencer el retardo.
+void test_presion_se_confirma_al_vencer_el_retardo(void) {
+    fijarEntrada(3, true);
+
+    TEST_ASSERT_EQUAL(0, debounceBank_Update(&bank, muestra, 100));
+    TEST_ASSERT_EQUAL(BUTTON_FALLING, debounceBank_State(&bank, 3));
+    TEST_ASSERT_EQUAL(0, debounceBank_Update(&bank, muestra, 100 + RETARDO - 1));
+    TEST_ASSERT_FALSE(debounceBank_ReadPressed(&bank, 3));
+
+    TEST_ASSERT_EQUAL(1, debounceBank_Update(&bank, muestra, 100 + RETARDO));
+    TEST_ASSERT_EQUAL(BUTTON_DOWN, debounceBank_State(&bank, 3));
+    TEST_ASSERT_TRUE(debounceBank_ReadPressed(&bank, 3));
+    TEST_ASSERT_FALSE(debounceBank_ReadPressed(&bank, 3));
+}
+
+//! * @test 3. Si la entrada vuelve antes de que venza el retardo, queda en BUTTON_UP sin flanco.
+void test_rebote_se_descarta(void) {
+    fijarEntrada(3, true);
+    debounceBank_Update(&bank, muestra, 100);
+    fijarEntrada(3, false);
+
+    TEST_ASSERT_EQUAL(0, debounceBank_Update(&bank, muestra, 100 + RETARDO));
+    TEST_ASSERT_EQUAL(BUTTON_UP, debounceBank_State(&bank, 3));
+    TEST_ASSERT_FALSE(debounceBank_ReadPressed(&bank, 3));
+}
+
+//! * @test 4. La liberación pasa por BUTTON_RISING y TakeEdges entrega y borra los flancos.
+void test_liberacion_y_take_edges(void) {
+    debounceBank_word_t pressed, released;
+
+    fijarEntrada(33, true);
+    debounceBank_Update(&bank, muestra, 0);
+    debounceBank_Update(&bank, muestra, RETARDO);
+    fijarEntrada(33, false);
+    debounceBank_Update(&bank, muestra, 2 * RETARDO);
+    TEST_ASSERT_EQUAL(BUTTON_RISING, debounceBank_State(&bank, 33));
+    debounceBank_Update(&bank, muestra, 3 * RETARDO);
+
+    TEST_ASSERT_EQUAL(BUTTON_UP, debounceBank_State(&bank, 33));
+    TEST_ASSERT_TRUE(debounceBank_TakeEdges(&bank, 1, &pressed, &released));
+    TEST_ASSERT_EQUAL_HEX32(1u << 1, pressed);
+    TEST_ASSERT_EQUAL_HEX32(1u << 1, released);
+    TEST_ASSERT_FALSE(debounceBank_TakeEdges(&bank, 1, &pressed, &released));
+    TEST_ASSERT_FALSE(debounceBank_TakeEdges(&bank, 2, &pressed, &released));
+}
+
+//! * @test 5. Los bits de la última palabra que no son entradas se ignoran.
+void test_bits_sobrantes_se_ignoran(void) {
+    muestra[0] = ~(debounceBank_word_t)0;
+    muestra[1] = ~(debounceBank_word_t)0;
+
+    debounceBank_Update(&bank, muestra, 0);
+    TEST_ASSERT_EQUAL(ENTRADAS, debounceBank_Update(&bank, muestra, RETARDO));
+    TEST_ASSERT_EQUAL(BUTTON_DOWN, debounceBank_State(&bank, ENTRADAS - 1));
+}
+
+//! * @test 6. El retardo vence correctamente aunque el contador de ticks desborde.
+void test_retardo_atraviesa_el_desborde(void) {
+    tick_t inicio = UINT32_MAX - RETARDO / 2;
+
+    fijarEntrada(0, true);
+    debounceBank_Update(&bank, muestra, inicio);
+    TEST_ASSERT_EQUAL(0, debounceBank_Update(&bank, muestra, inicio + RETARDO - 1));
+    TEST_ASSERT_EQUAL(1, debounceBank_Update(&bank, muestra, inicio + RETARDO));
+}
+
+/* === End of documentation ==================================================================== */
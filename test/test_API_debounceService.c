@@ -0,0 +1,179 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file test_API_debounceService.c
+ * @brief Pruebas unitarias para el servicio de antirrebote multihilo
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "API_debounceService.h"
+#include "API_debounceBank.h"
+#include "API_delay.h"
+
+#include <time.h>
+
+/* === Macros definitions ====================================================================== */
+/** @brief Entradas del servicio de prueba, el último shard queda incompleto */
+#define ENTRADAS 5000
+/** @brief Retardo de antirrebote usado en las pruebas con Poll() */
+#define RETARDO DELAY_MS(TIEMPO_RETARDO)
+/** @brief Entradas que se presionan en la prueba con hilos */
+#define PRESIONES 64
+/** @brief Esperas de 1 ms antes de dar por perdido un evento */
+#define ESPERAS_MAXIMAS 2000
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+static debounceService_t service;
+static debounceServiceEvent_t ultimo;
+static atomic_uint recibidos;
+static atomic_uint sumaEntradas;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+//! * @brief Los hilos leen el tick del sistema, que queda fijo: el retardo 0 vence en la vuelta
+//! *        siguiente a la muestra.
+uint32_t HAL_GetTick(void) {
+    return 0;
+}
+
+//! * @brief Cuenta los eventos recibidos desde cualquier hilo; sin hilos guarda el último en el
+//! *        contexto.
+void registrarEvento(const debounceServiceEvent_t * event, void * contexto) {
+    if (contexto != NULL) {
+        *(debounceServiceEvent_t *)contexto = *event;
+    }
+    atomic_fetch_add(&sumaEntradas, event->entrada);
+    atomic_fetch_add(&recibidos, 1u);
+}
+
+//! * @brief Inicializa el servicio con la cantidad de hilos y el retardo indicados.
+void iniciarServicio(uint8_t hilos, tick_t duracion) {
+    debounceServiceConfig_t config = {ENTRADAS, hilos, duracion, registrarEvento,
+                                      hilos == 0 ? &ultimo : NULL};
+
+    TEST_ASSERT_TRUE(debounceService_Init(&service, &config));
+}
+
+void setUp(void) {
+    ultimo = (debounceServiceEvent_t){0};
+    atomic_store(&recibidos, 0u);
+    atomic_store(&sumaEntradas, 0u);
+}
+
+void tearDown(void) {
+    debounceService_Destroy(&service);
+}
+
+//! * @test 1. Init rechaza un servicio sin entradas y reparte todas en shards de palabras enteras.
+void test_init_reparte_entradas_en_shards(void) {
+    debounceServiceConfig_t vacio = {0, 1, RETARDO, NULL, NULL};
+
+    TEST_ASSERT_FALSE(debounceService_Init(&service, &vacio));
+    iniciarServicio(2, RETARDO);
+
+    TEST_ASSERT_EQUAL(0, service.entradasPorShard % DEBOUNCE_BANK_WIDTH);
+    TEST_ASSERT_LESS_OR_EQUAL(2 * DEBOUNCE_SERVICE_SHARDS_POR_HILO, service.cantidadShards);
+    TEST_ASSERT_GREATER_OR_EQUAL(ENTRADAS, service.cantidadShards * service.entradasPorShard);
+    TEST_ASSERT_FALSE(debounceService_Push(&service, ENTRADAS, true));
+}
+
+//! * @test 2. Sin hilos, Poll() aplica las muestras y confirma el flanco cuando vence el retardo.
+void test_poll_confirma_al_vencer_el_retardo(void) {
+    iniciarServicio(0, RETARDO);
+    TEST_ASSERT_FALSE(debounceService_Start(&service));
+
+    TEST_ASSERT_TRUE(debounceService_Push(&service, 4321, true));
+    TEST_ASSERT_EQUAL(1, debounceService_Poll(&service, 100));
+    TEST_ASSERT_EQUAL(0, debounceService_Poll(&service, 100 + RETARDO - 1));
+    TEST_ASSERT_EQUAL(0, atomic_load(&recibidos));
+
+    debounceService_Poll(&service, 100 + RETARDO);
+    TEST_ASSERT_EQUAL(1, atomic_load(&recibidos));
+    TEST_ASSERT_EQUAL(4321, ultimo.entrada);
+    TEST_ASSERT_EQUAL(EVENT_PRESSED, ultimo.edge);
+    TEST_ASSERT_EQUAL(100 + RETARDO, ultimo.tick);
+
+    TEST_ASSERT_TRUE(debounceService_Push(&service, 4321, false));
+    debounceService_Poll(&service, 200);
+    debounceService_Poll(&service, 200 + RETARDO);
+    TEST_ASSERT_EQUAL(2, atomic_load(&recibidos));
+    TEST_ASSERT_EQUAL(EVENT_RELEASED, ultimo.edge);
+}
+
+//! * @test 3. Una cola llena rechaza la muestra y la cuenta; Poll() las saca de a lotes.
+void test_cola_llena_descarta_y_cuenta(void) {
+    debounceServiceStats_t stats;
+
+    iniciarServicio(0, RETARDO);
+    for (uint32_t i = 0; i < DEBOUNCE_SERVICE_COLA; i++) {
+        TEST_ASSERT_TRUE(debounceService_Push(&service, 7, (i & 1u) == 0));
+    }
+    TEST_ASSERT_FALSE(debounceService_Push(&service, 7, true));
+
+    TEST_ASSERT_EQUAL(DEBOUNCE_SERVICE_LOTE, debounceService_Poll(&service, 0));
+    TEST_ASSERT_TRUE(debounceService_Push(&service, 7, true));
+
+    debounceService_GetStats(&service, &stats);
+    TEST_ASSERT_EQUAL(1, stats.descartadas);
+    TEST_ASSERT_EQUAL(DEBOUNCE_SERVICE_LOTE, stats.muestras);
+}
+
+//! * @test 4. Con hilos trabajadores cada presión encolada llega una vez al manejador.
+void test_hilos_entregan_cada_evento(void) {
+    const struct timespec espera = {0, 1000000};
+    debounceServiceStats_t stats;
+    uint32_t suma = 0;
+
+    iniciarServicio(2, 0);
+    TEST_ASSERT_TRUE(debounceService_Start(&service));
+    TEST_ASSERT_FALSE(debounceService_Start(&service));
+
+    for (uint32_t i = 0; i < PRESIONES; i++) {
+        uint32_t entrada = i * (ENTRADAS / PRESIONES);
+
+        TEST_ASSERT_TRUE(debounceService_Push(&service, entrada, true));
+        suma += entrada;
+    }
+    for (int i = 0; i < ESPERAS_MAXIMAS && atomic_load(&recibidos) < PRESIONES; i++) {
+        nanosleep(&espera, NULL);
+    }
+    debounceService_Stop(&service);
+
+    debounceService_GetStats(&service, &stats);
+    TEST_ASSERT_EQUAL(PRESIONES, atomic_load(&recibidos));
+    TEST_ASSERT_EQUAL(suma, atomic_load(&sumaEntradas));
+    TEST_ASSERT_EQUAL(PRESIONES, stats.muestras);
+    TEST_ASSERT_EQUAL(PRESIONES, stats.eventos);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,135 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file test_API_debounceStats.c
+ * @brief Pruebas unitarias de las estadísticas de antirrebote
+ * @note Se compila con DEBOUNCE_STATS=1 (ver project.yml)
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "mock_API_IO.h"
+#include "API_debounce.h"
+#include "API_delay.h"
+#include "API_eventQueue.h"
+
+/* === Macros definitions ====================================================================== */
+#define ACTIVO   ((IO_Snapshot_t)1u << IO_BUTTON_USER)
+#define INACTIVO ((IO_Snapshot_t)0u)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+static debounce_t boton;
+static debounceStats_t stats;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+//! * @brief Las pruebas usan las variantes con tick explícito, el tick del sistema queda fijo.
+uint32_t HAL_GetTick(void) {
+    return 0;
+}
+
+void setUp(void) {
+    event_t descartado;
+
+    while (debounce_ReadEvent(&descartado)) {
+    }
+    debounce_Init(&boton, IO_BUTTON_USER);
+}
+
+//! * @test 1. Cada evento confirmado registra su latencia desde el primer flanco crudo y cada
+//! *         antirrebote que vuelve al estado estable anterior cuenta como abortado.
+// Tick  Entrada  Transición
+// 100   1        BUTTON_UP -> BUTTON_FALLING (primer flanco)
+// 150   1        BUTTON_FALLING -> BUTTON_DOWN (presión, latencia 50)
+// 300   0        BUTTON_DOWN -> BUTTON_RISING
+// 350   1        BUTTON_RISING -> BUTTON_DOWN (liberación abortada)
+// 400   0        BUTTON_DOWN -> BUTTON_RISING
+// 450   0        BUTTON_RISING -> BUTTON_UP (liberación, latencia 50)
+// 500   1        BUTTON_UP -> BUTTON_FALLING
+// 550   0        BUTTON_FALLING -> BUTTON_UP (presión abortada)
+void test_latencias_y_abortos(void) {
+    static const struct {
+        tick_t tick;
+        IO_Snapshot_t entrada;
+    } pasos[] = {{100, ACTIVO},   {150, ACTIVO},   {300, INACTIVO}, {350, ACTIVO},
+                 {400, INACTIVO}, {450, INACTIVO}, {500, ACTIVO},   {550, INACTIVO}};
+
+    for (unsigned i = 0; i < sizeof(pasos) / sizeof(pasos[0]); i++) {
+        debounce_UpdateSnapshotAt(&boton, pasos[i].entrada, pasos[i].tick);
+    }
+
+    TEST_ASSERT_TRUE(debounce_GetStats(&boton, &stats));
+    TEST_ASSERT_EQUAL(2, stats.eventos);
+    TEST_ASSERT_EQUAL(1, stats.abortosPresion);
+    TEST_ASSERT_EQUAL(1, stats.abortosLiberacion);
+    TEST_ASSERT_EQUAL(50, stats.latenciaMinima);
+    TEST_ASSERT_EQUAL(50, stats.latenciaMaxima);
+    TEST_ASSERT_EQUAL(2, stats.histograma[50 / DEBOUNCE_STATS_BIN_TICKS]);
+    TEST_ASSERT_EQUAL(450, stats.ultimoEvento);
+    TEST_ASSERT_EQUAL(500, stats.primerFlanco);
+}
+
+//! * @test 2. Una latencia mayor que el histograma se acumula en el último intervalo, con
+//! *         cualquier algoritmo.
+void test_latencia_fuera_de_rango(void) {
+    tick_t tick = 0;
+
+    debounce_InitWith(&boton, IO_BUTTON_USER, DEBOUNCE_ALG_INTEGRATOR);
+    for (int i = 0; i < DEBOUNCE_INTEGRADOR_MAX; i++) {
+        debounce_UpdateSnapshotAt(&boton, ACTIVO, tick);
+        tick += DEBOUNCE_STATS_BINS * DEBOUNCE_STATS_BIN_TICKS;
+    }
+
+    debounce_GetStats(&boton, &stats);
+    TEST_ASSERT_EQUAL(1, stats.eventos);
+    TEST_ASSERT_EQUAL(1, stats.histograma[DEBOUNCE_STATS_BINS - 1]);
+}
+
+//! * @test 3. Las estadísticas se ponen en cero al reiniciarlas y al inicializar la instancia.
+void test_reinicio_de_estadisticas(void) {
+    debounce_UpdateSnapshotAt(&boton, ACTIVO, 100);
+    debounce_UpdateSnapshotAt(&boton, INACTIVO, 150);
+    debounce_GetStats(&boton, &stats);
+    TEST_ASSERT_EQUAL(1, stats.abortosPresion);
+
+    debounce_ResetStats(&boton);
+    debounce_GetStats(&boton, &stats);
+    TEST_ASSERT_EQUAL(0, stats.abortosPresion);
+
+    debounce_UpdateSnapshotAt(&boton, ACTIVO, 200);
+    debounce_UpdateSnapshotAt(&boton, INACTIVO, 250);
+    debounce_Init(&boton, IO_BUTTON_USER);
+    debounce_GetStats(&boton, &stats);
+    TEST_ASSERT_EQUAL(0, stats.abortosPresion);
+}
+
+/* === End of documentation ==================================================================== */
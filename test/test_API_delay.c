@@ -0,0 +1,222 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file test_API_delay.c
+ * @brief Pruebas unitarias para la librería de API_delay
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "API_delay.h"
+
+/* === Macros definitions ====================================================================== */
+#define DURACION 100
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+static delay_t retardo;
+static delay_t otro;
+static int vencimientos;
+static tick_t tickSimulado;
+/** @brief Tick desde el que reprogramarSiVence() vuelve a iniciar el retardo */
+static tick_t reinicio;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+//! * @brief Las pruebas usan las variantes con tick explícito, el tick del sistema queda fijo.
+uint32_t HAL_GetTick(void) {
+    return 0;
+}
+
+//! * @brief Callback que cuenta los vencimientos informados por el servicio.
+void contarVencimiento(delay_t * delay) {
+    vencimientos++;
+}
+
+//! * @brief Callback que cuenta el vencimiento y vuelve a iniciar el retardo desde reinicio.
+void reprogramarSiVence(delay_t * delay) {
+    vencimientos++;
+    delayStartAt(delay, reprogramarSiVence, reinicio);
+}
+
+//! * @brief Fuente de reloj alternativa, por ejemplo un contador de microsegundos.
+tick_t relojSimulado(void) {
+    return tickSimulado;
+}
+
+void setUp(void) {
+    vencimientos = 0;
+    delayInit(&retardo, DURACION);
+    delayInit(&otro, 2 * DURACION);
+}
+
+void tearDown(void) {
+    delayStop(&retardo);
+    delayStop(&otro);
+    delay_SetClock(NULL);
+}
+
+//! * @test 1. El retardo se inicia en la primera lectura y vence al cumplir su duración.
+void test_retardo_vence_al_cumplir_duracion(void) {
+
+    TEST_ASSERT_FALSE(delayReadAt(&retardo, 1000));
+    TEST_ASSERT_FALSE(delayReadAt(&retardo, 1000 + DURACION - 1));
+    TEST_ASSERT_TRUE(delayReadAt(&retardo, 1000 + DURACION));
+    TEST_ASSERT_FALSE(retardo.running);
+}
+
+//! * @test 2. El vencimiento se calcula bien cuando el contador de ticks desborda.
+void test_retardo_vence_con_desborde_de_ticks(void) {
+
+    TEST_ASSERT_FALSE(delayReadAt(&retardo, UINT32_MAX - 10));
+    TEST_ASSERT_FALSE(delayReadAt(&retardo, 20));
+    TEST_ASSERT_TRUE(delayReadAt(&retardo, DURACION));
+}
+
+//! * @test 3. El servicio informa primero el vencimiento más cercano y vence solo lo debido.
+void test_servicio_vence_en_orden(void) {
+    tick_t proximo;
+
+    TEST_ASSERT_FALSE(delay_NextDeadline(&proximo));
+
+    delayStartAt(&otro, contarVencimiento, 0);
+    delayStartAt(&retardo, contarVencimiento, 0);
+
+    TEST_ASSERT_TRUE(delay_NextDeadline(&proximo));
+    TEST_ASSERT_EQUAL(DURACION, proximo);
+
+    TEST_ASSERT_EQUAL(0, delayProcessAt(DURACION - 1));
+    TEST_ASSERT_EQUAL(1, delayProcessAt(DURACION));
+    TEST_ASSERT_FALSE(retardo.running);
+
+    TEST_ASSERT_TRUE(delay_NextDeadline(&proximo));
+    TEST_ASSERT_EQUAL(2 * DURACION, proximo);
+    TEST_ASSERT_EQUAL(1, delayProcessAt(3 * DURACION));
+    TEST_ASSERT_EQUAL(2, vencimientos);
+    TEST_ASSERT_FALSE(delay_NextDeadline(&proximo));
+}
+
+//! * @test 4. Un retardo detenido no vence ni llama a su callback.
+void test_servicio_retardo_detenido_no_vence(void) {
+
+    delayStartAt(&retardo, contarVencimiento, 0);
+    delayStop(&retardo);
+
+    TEST_ASSERT_EQUAL(0, delayProcessAt(DURACION));
+    TEST_ASSERT_EQUAL(0, vencimientos);
+}
+
+//! * @test 5. Con otra fuente de reloj los retardos y el tick del sistema la usan, y NULL vuelve a
+//! *         la fuente por defecto.
+void test_fuente_de_reloj_intercambiable(void) {
+    tickSimulado = 5000;
+    delay_SetClock(relojSimulado);
+
+    TEST_ASSERT_EQUAL(5000, delayGetTick());
+    TEST_ASSERT_FALSE(delayRead(&retardo));
+    tickSimulado += DURACION;
+    TEST_ASSERT_TRUE(delayRead(&retardo));
+
+    delay_SetClock(NULL);
+    TEST_ASSERT_EQUAL(0, delayGetTick());
+}
+
+//! * @test 6. Las duraciones fuera de los límites configurados se ajustan a DELAY_MIN y DELAY_MAX,
+//! *         salvo con delay_SetDuration(), que solo ajusta a DELAY_MAX.
+void test_duracion_ajustada_a_los_limites(void) {
+    delayInit(&retardo, 0);
+    TEST_ASSERT_EQUAL(DELAY_MIN, retardo.duration);
+
+    delayWrite(&retardo, UINT32_MAX);
+    TEST_ASSERT_EQUAL(DELAY_MAX, retardo.duration);
+
+    delay_SetDuration(&retardo, 1);
+    TEST_ASSERT_EQUAL(1, retardo.duration);
+    delay_SetDuration(&retardo, UINT32_MAX);
+    TEST_ASSERT_EQUAL(DELAY_MAX, retardo.duration);
+}
+
+//! * @test 7. El servicio ordena bien los vencimientos a ambos lados del desborde del contador,
+//! *         que con ticks de microsegundos ocurre cada 71 minutos.
+void test_servicio_ordena_con_desborde_de_ticks(void) {
+    const tick_t inicio = UINT32_MAX - 3 * DURACION / 2;
+    tick_t proximo;
+
+    /* retardo vence antes del desborde y otro, el doble de largo, después */
+    delayStartAt(&otro, contarVencimiento, inicio);
+    delayStartAt(&retardo, contarVencimiento, inicio);
+
+    TEST_ASSERT_TRUE(delay_NextDeadline(&proximo));
+    TEST_ASSERT_EQUAL(inicio + DURACION, proximo);
+    TEST_ASSERT_EQUAL(1, delayProcessAt(inicio + DURACION));
+    TEST_ASSERT_FALSE(retardo.running);
+
+    TEST_ASSERT_TRUE(delay_NextDeadline(&proximo));
+    TEST_ASSERT_EQUAL(DURACION / 2 - 1, proximo);
+    TEST_ASSERT_EQUAL(0, delayProcessAt(UINT32_MAX));
+    TEST_ASSERT_EQUAL(1, delayProcessAt(DURACION / 2 - 1));
+}
+
+//! * @test 8. Un callback que se reprograma desde un tick futuro o ya vencido no vuelve a vencer en
+//! *         la misma llamada.
+void test_servicio_callback_reprogramado_no_se_repite(void) {
+    /* Inicio posterior a now: no vence hasta cumplir la duración desde ese inicio */
+    reinicio = DURACION + 10;
+    delayStartAt(&retardo, reprogramarSiVence, 0);
+    TEST_ASSERT_EQUAL(1, delayProcessAt(DURACION));
+    TEST_ASSERT_EQUAL(0, delayProcessAt(DURACION + 5));
+    TEST_ASSERT_EQUAL(0, delayProcessAt(2 * DURACION + 9));
+
+    /* Reprogramado ya vencido: queda para la próxima llamada */
+    reinicio = 0;
+    TEST_ASSERT_EQUAL(1, delayProcessAt(2 * DURACION + 10));
+    TEST_ASSERT_EQUAL(1, delayProcessAt(2 * DURACION + 10));
+    TEST_ASSERT_EQUAL(3, vencimientos);
+    TEST_ASSERT_TRUE(retardo.running);
+}
+
+//! * @test 9. Un retardo reprogramado ya vencido no demora a los demás vencidos de la llamada.
+void test_servicio_postergado_no_demora_a_los_demas(void) {
+    tick_t proximo;
+
+    reinicio = 0;
+    delayStartAt(&retardo, reprogramarSiVence, 0);
+    delayStartAt(&otro, contarVencimiento, 0);
+
+    TEST_ASSERT_EQUAL(2, delayProcessAt(2 * DURACION));
+    TEST_ASSERT_FALSE(otro.running);
+    TEST_ASSERT_TRUE(delay_NextDeadline(&proximo));
+    TEST_ASSERT_EQUAL(DURACION, proximo);
+    TEST_ASSERT_EQUAL(1, delayProcessAt(2 * DURACION));
+    TEST_ASSERT_EQUAL(3, vencimientos);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,118 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file test_API_eventQueue.c
+ * @brief Pruebas unitarias para la cola de eventos sin bloqueo
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "API_eventQueue.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+static eventQueue_t cola;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+//! * @brief Encola un evento de presión del dispositivo indicado con el tick indicado.
+bool_t encolar(uint16_t device, tick_t tick) {
+    event_t evento = {.device = device, .edge = EVENT_PRESSED, .tick = tick};
+
+    return eventQueue_Push(&cola, &evento);
+}
+
+void setUp(void) {
+    eventQueue_Init(&cola);
+}
+
+//! * @test 1. Una cola recién inicializada está vacía.
+void test_cola_inicial_vacia(void) {
+    event_t evento;
+
+    TEST_ASSERT_EQUAL(0, eventQueue_Count(&cola));
+    TEST_ASSERT_FALSE(eventQueue_Pop(&cola, &evento));
+}
+
+//! * @test 2. Los eventos se extraen en el mismo orden y con los mismos datos que se encolaron.
+void test_eventos_salen_en_orden(void) {
+    event_t evento;
+
+    encolar(1, 100);
+    encolar(2, 150);
+
+    TEST_ASSERT_TRUE(eventQueue_Pop(&cola, &evento));
+    TEST_ASSERT_EQUAL(1, evento.device);
+    TEST_ASSERT_EQUAL(100, evento.tick);
+    TEST_ASSERT_TRUE(eventQueue_Pop(&cola, &evento));
+    TEST_ASSERT_EQUAL(2, evento.device);
+    TEST_ASSERT_EQUAL(150, evento.tick);
+}
+
+//! * @test 3. Con la cola llena los eventos nuevos se descartan y se cuentan como desborde.
+void test_cola_llena_cuenta_desbordes(void) {
+    eventQueueStats_t stats;
+    event_t evento;
+
+    for (int i = 0; i < EVENT_QUEUE_SIZE; i++) {
+        TEST_ASSERT_TRUE(encolar(i, i));
+    }
+    TEST_ASSERT_FALSE(encolar(99, 99));
+    TEST_ASSERT_FALSE(encolar(99, 99));
+
+    eventQueue_GetStats(&cola, &stats);
+    TEST_ASSERT_EQUAL(EVENT_QUEUE_SIZE, stats.pushed);
+    TEST_ASSERT_EQUAL(2, stats.overflows);
+    TEST_ASSERT_EQUAL(EVENT_QUEUE_SIZE, stats.highWater);
+
+    TEST_ASSERT_TRUE(eventQueue_Pop(&cola, &evento));
+    TEST_ASSERT_EQUAL(0, evento.device);
+}
+
+//! * @test 4. La cola sigue funcionando al dar varias vueltas al buffer circular.
+void test_cola_da_la_vuelta(void) {
+    eventQueueStats_t stats;
+    event_t evento;
+
+    for (int i = 0; i < 3 * EVENT_QUEUE_SIZE; i++) {
+        TEST_ASSERT_TRUE(encolar(i, i));
+        TEST_ASSERT_TRUE(eventQueue_Pop(&cola, &evento));
+        TEST_ASSERT_EQUAL(i, evento.device);
+    }
+
+    eventQueue_GetStats(&cola, &stats);
+    TEST_ASSERT_EQUAL(1, stats.highWater);
+    TEST_ASSERT_EQUAL(0, stats.overflows);
+}
+
+/* === End of documentation ==================================================================== */
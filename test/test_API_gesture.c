@@ -0,0 +1,201 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file test_API_gesture.c
+ * @brief Pruebas unitarias de los gestos sobre el servicio de temporizadores, en tiempo virtual
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "API_gesture.h"
+#include "API_delay.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Máxima cantidad de gestos registrados por prueba */
+#define MAX_GESTOS 16
+/** @brief Tiempo para una pulsación larga */
+#define LARGA DELAY_MS(800)
+/** @brief Ventana de doble click */
+#define DOBLE DELAY_MS(300)
+/** @brief Período de repetición */
+#define REPETICION DELAY_MS(100)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+static gestureConfig_t config;
+static gesture_t boton;
+static gesture_t otro;
+/** @brief Gestos recibidos, con la entrada y el tick de cada uno */
+static struct {
+    uint16_t id;
+    gestureEvent_t evento;
+    tick_t tick;
+} gestos[MAX_GESTOS];
+static int cantidad;
+/** @brief Retardos que llenan el servicio de temporizadores */
+static delay_t relleno[DELAY_SERVICE_SIZE];
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+//! * @brief Las pruebas usan las variantes con tick explícito, el tick del sistema queda fijo.
+uint32_t HAL_GetTick(void) {
+    return 0;
+}
+
+//! * @brief Guarda cada gesto recibido.
+void registrarGesto(gesture_t * gesture, gestureEvent_t evento, tick_t tick, void * contexto) {
+    (void)contexto;
+    if (cantidad < MAX_GESTOS) {
+        gestos[cantidad].id = gesture->id;
+        gestos[cantidad].evento = evento;
+        gestos[cantidad].tick = tick;
+    }
+    cantidad++;
+}
+
+//! * @brief Avanza el tiempo virtual procesando los vencimientos de a un tick.
+void avanzar(tick_t desde, tick_t hasta) {
+    for (tick_t t = desde; t <= hasta; t++) {
+        delayProcessAt(t);
+    }
+}
+
+void setUp(void) {
+    config = (gestureConfig_t){LARGA, DOBLE, REPETICION, registrarGesto, NULL};
+    gesture_Init(&boton, 1, &config);
+    gesture_Init(&otro, 2, &config);
+    cantidad = 0;
+}
+
+void tearDown(void) {
+    gesture_Reset(&boton);
+    gesture_Reset(&otro);
+    for (int i = 0; i < DELAY_SERVICE_SIZE; i++) {
+        delayStop(&relleno[i]);
+    }
+}
+
+//! * @test 1. Una presión corta se informa como click al cerrarse la ventana de doble click.
+void test_click_al_vencer_la_ventana(void) {
+    gesture_Feed(&boton, EVENT_PRESSED, 1000);
+    gesture_Feed(&boton, EVENT_RELEASED, 1100);
+
+    avanzar(1100, 1100 + DOBLE - 1);
+    TEST_ASSERT_EQUAL(0, cantidad);
+
+    avanzar(1100 + DOBLE, 1100 + DOBLE + LARGA);
+    TEST_ASSERT_EQUAL(1, cantidad);
+    TEST_ASSERT_EQUAL(GESTURE_CLICK, gestos[0].evento);
+    TEST_ASSERT_EQUAL(1100 + DOBLE, gestos[0].tick);
+    TEST_ASSERT_EQUAL(1, gestos[0].id);
+}
+
+//! * @test 2. Una segunda presión dentro de la ventana es un doble click y no deja un click.
+void test_doble_click(void) {
+    gesture_Feed(&boton, EVENT_PRESSED, 1000);
+    gesture_Feed(&boton, EVENT_RELEASED, 1100);
+    avanzar(1100, 1200);
+    gesture_Feed(&boton, EVENT_PRESSED, 1200);
+    gesture_Feed(&boton, EVENT_RELEASED, 1300);
+    avanzar(1200, 1300 + LARGA + DOBLE);
+
+    TEST_ASSERT_EQUAL(1, cantidad);
+    TEST_ASSERT_EQUAL(GESTURE_DOUBLE_CLICK, gestos[0].evento);
+    TEST_ASSERT_EQUAL(1200, gestos[0].tick);
+}
+
+//! * @test 3. Mantener presionado informa la pulsación larga y las repeticiones sin atraso.
+void test_pulsacion_larga_y_repeticion(void) {
+    gesture_Feed(&boton, EVENT_PRESSED, 1000);
+    avanzar(1000, 1000 + LARGA + 2 * REPETICION);
+    gesture_Feed(&boton, EVENT_RELEASED, 1000 + LARGA + 2 * REPETICION + 50);
+    avanzar(1000 + LARGA + 2 * REPETICION, 1000 + LARGA + 2 * REPETICION + 2 * DOBLE);
+
+    TEST_ASSERT_EQUAL(3, cantidad);
+    TEST_ASSERT_EQUAL(GESTURE_LONG_PRESS, gestos[0].evento);
+    TEST_ASSERT_EQUAL(1000 + LARGA, gestos[0].tick);
+    TEST_ASSERT_EQUAL(GESTURE_REPEAT, gestos[1].evento);
+    TEST_ASSERT_EQUAL(1000 + LARGA + REPETICION, gestos[1].tick);
+    TEST_ASSERT_EQUAL(GESTURE_REPEAT, gestos[2].evento);
+    TEST_ASSERT_EQUAL(1000 + LARGA + 2 * REPETICION, gestos[2].tick);
+}
+
+//! * @test 4. Sin ventana de doble click ni repetición, el click sale al soltar y la larga una vez.
+void test_gestos_deshabilitados(void) {
+    config.dobleClick = 0;
+    config.repeticion = 0;
+
+    gesture_Feed(&boton, EVENT_PRESSED, 1000);
+    gesture_Feed(&boton, EVENT_RELEASED, 1100);
+    TEST_ASSERT_EQUAL(1, cantidad);
+    TEST_ASSERT_EQUAL(GESTURE_CLICK, gestos[0].evento);
+    TEST_ASSERT_EQUAL(1100, gestos[0].tick);
+
+    gesture_Feed(&boton, EVENT_PRESSED, 2000);
+    avanzar(2000, 2000 + 3 * LARGA);
+    gesture_Feed(&boton, EVENT_RELEASED, 2000 + 3 * LARGA);
+    TEST_ASSERT_EQUAL(2, cantidad);
+    TEST_ASSERT_EQUAL(GESTURE_LONG_PRESS, gestos[1].evento);
+}
+
+//! * @test 5. Dos entradas con la misma configuración reconocen sus gestos por separado.
+void test_entradas_independientes(void) {
+    gesture_Feed(&boton, EVENT_PRESSED, 1000);
+    gesture_Feed(&otro, EVENT_PRESSED, 1050);
+    gesture_Feed(&otro, EVENT_RELEASED, 1100);
+    avanzar(1000, 1000 + LARGA);
+    gesture_Feed(&boton, EVENT_RELEASED, 1000 + LARGA + 10);
+
+    TEST_ASSERT_EQUAL(2, cantidad);
+    TEST_ASSERT_EQUAL(2, gestos[0].id);
+    TEST_ASSERT_EQUAL(GESTURE_CLICK, gestos[0].evento);
+    TEST_ASSERT_EQUAL(1, gestos[1].id);
+    TEST_ASSERT_EQUAL(GESTURE_LONG_PRESS, gestos[1].evento);
+}
+
+//! * @test 6. Con el servicio de temporizadores lleno la presión lo informa y el click sale al
+//! *         soltar.
+void test_servicio_lleno(void) {
+    for (int i = 0; i < DELAY_SERVICE_SIZE; i++) {
+        delayInit(&relleno[i], DELAY_MAX);
+        TEST_ASSERT_TRUE(delayStartAt(&relleno[i], NULL, 1000));
+    }
+
+    TEST_ASSERT_FALSE(gesture_Feed(&boton, EVENT_PRESSED, 1000));
+    TEST_ASSERT_FALSE(gesture_Feed(&boton, EVENT_RELEASED, 1000 + LARGA + 1));
+    TEST_ASSERT_EQUAL(1, cantidad);
+    TEST_ASSERT_EQUAL(GESTURE_CLICK, gestos[0].evento);
+
+    delayStop(&relleno[0]);
+    TEST_ASSERT_TRUE(gesture_Feed(&boton, EVENT_PRESSED, 2000));
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,187 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file test_API_matrix.c
+ * @brief Pruebas unitarias del barrido de teclados contra una matriz simulada sobre la HAL emulada
+ * @details La espera entre columnas calcula las filas a partir de las columnas activas en ODR,
+ * propagando la corriente por las teclas presionadas como en una matriz sin diodos.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "API_matrix.h"
+#include "API_IO.h"
+#include "API_debounceBank.h"
+#include "hal_host.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Lado del teclado simulado */
+#define LADO 4
+/** @brief Retardo de antirrebote usado en las pruebas */
+#define RETARDO DELAY_MS(TIEMPO_RETARDO)
+/** @brief Código de la tecla de una fila y una columna */
+#define TECLA(fila, columna) ((fila) * LADO + (columna))
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+static const IO_Device_t columnas[LADO] = MATRIX_KEYPAD_COLUMNS;
+static const IO_Device_t filas[LADO] = MATRIX_KEYPAD_ROWS;
+static matrix_t matrix;
+static matrixReport_t reporte;
+/** @brief Teclas presionadas en el teclado simulado */
+static bool presionadas[LADO][LADO];
+static tick_t now;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+//! * @brief Actualiza las filas del teclado simulado según las columnas activas.
+void simularMatriz(void * contexto) {
+    bool columnaActiva[LADO] = {false};
+    bool filaActiva[LADO] = {false};
+    bool cambio = true;
+    uint32_t idr = 0;
+
+    (void)contexto;
+    for (int c = 0; c < LADO; c++) {
+        columnaActiva[c] = (GPIOA->ODR & (GPIO_PIN_0 << c)) != 0;
+    }
+    /* Sin diodos la corriente recorre cualquier camino de teclas presionadas */
+    while (cambio) {
+        cambio = false;
+        for (int f = 0; f < LADO; f++) {
+            for (int c = 0; c < LADO; c++) {
+                if (presionadas[f][c] && columnaActiva[c] != filaActiva[f]) {
+                    columnaActiva[c] = filaActiva[f] = true;
+                    cambio = true;
+                }
+            }
+        }
+    }
+    for (int f = 0; f < LADO; f++) {
+        idr |= filaActiva[f] ? (uint32_t)(GPIO_PIN_4 << f) : 0;
+    }
+    GPIOA->IDR = idr;
+}
+
+//! * @brief Barre el teclado dos veces separadas por el retardo de antirrebote.
+uint8_t barrerConfirmando(void) {
+    uint8_t cambios = matrix_Scan(&matrix, now, &reporte);
+
+    now += RETARDO;
+    return cambios + matrix_Scan(&matrix, now, &reporte);
+}
+
+void setUp(void) {
+    for (int f = 0; f < LADO; f++) {
+        for (int c = 0; c < LADO; c++) {
+            presionadas[f][c] = false;
+        }
+    }
+    GPIOA->IDR = 0;
+    now = 1000;
+    IO_Init();
+    matrix_Init(&matrix, columnas, LADO, filas, LADO, RETARDO);
+    matrix_SetSettle(&matrix, simularMatriz, NULL);
+}
+
+//! * @test 1. Init rechaza dimensiones fuera de rango y dispositivos inexistentes.
+void test_init_valida_la_configuracion(void) {
+    const IO_Device_t invalidos[LADO] = {IO_KEY_COL0, IO_DEVICE_COUNT, IO_KEY_COL2, IO_KEY_COL3};
+
+    TEST_ASSERT_FALSE(matrix_Init(&matrix, columnas, 0, filas, LADO, RETARDO));
+    TEST_ASSERT_FALSE(matrix_Init(&matrix, columnas, MATRIX_MAX_COLUMNS + 1, filas, LADO, RETARDO));
+    TEST_ASSERT_FALSE(matrix_Init(&matrix, invalidos, LADO, filas, LADO, RETARDO));
+    TEST_ASSERT_TRUE(matrix_Init(&matrix, columnas, LADO, filas, LADO, RETARDO));
+}
+
+//! * @test 2. Una presión se reporta una sola vez, después del antirrebote, con su código.
+void test_presion_se_reporta_una_vez(void) {
+    presionadas[2][1] = true;
+
+    TEST_ASSERT_EQUAL(0, matrix_Scan(&matrix, now, &reporte));
+    now += RETARDO;
+    TEST_ASSERT_EQUAL(1, matrix_Scan(&matrix, now, &reporte));
+    TEST_ASSERT_EQUAL(1, reporte.cantidad);
+    TEST_ASSERT_EQUAL_HEX8(TECLA(2, 1) | MATRIX_KEY_PRESSED, reporte.teclas[0]);
+    TEST_ASSERT_TRUE(matrix_IsPressed(&matrix, TECLA(2, 1)));
+
+    TEST_ASSERT_EQUAL(0, matrix_Scan(&matrix, now + RETARDO, &reporte));
+    TEST_ASSERT_EQUAL(0, reporte.cantidad);
+}
+
+//! * @test 3. La liberación se reporta sin MATRIX_KEY_PRESSED y las columnas quedan en reposo.
+void test_liberacion_y_columnas_en_reposo(void) {
+    presionadas[0][3] = true;
+    barrerConfirmando();
+    presionadas[0][3] = false;
+    now += RETARDO;
+
+    TEST_ASSERT_EQUAL(1, barrerConfirmando());
+    TEST_ASSERT_EQUAL_HEX8(TECLA(0, 3), reporte.teclas[0]);
+    TEST_ASSERT_FALSE(matrix_IsPressed(&matrix, TECLA(0, 3)));
+    TEST_ASSERT_EQUAL_HEX32(0, GPIOA->ODR & 0x0Fu);
+}
+
+//! * @test 4. Varias teclas sin formar rectángulos se reportan juntas (N-key rollover).
+void test_varias_teclas_a_la_vez(void) {
+    for (int i = 0; i < LADO; i++) {
+        presionadas[i][i] = true;
+    }
+
+    TEST_ASSERT_EQUAL(LADO, barrerConfirmando());
+    for (int i = 0; i < LADO; i++) {
+        TEST_ASSERT_EQUAL_HEX8(TECLA(i, i) | MATRIX_KEY_PRESSED, reporte.teclas[i]);
+    }
+    TEST_ASSERT_EQUAL(0, matrix_GhostCount(&matrix));
+}
+
+//! * @test 5. La tecla fantasma de un rectángulo no se reporta y se cuenta el barrido ambiguo.
+void test_fantasma_no_se_reporta(void) {
+    presionadas[0][0] = true;
+    presionadas[0][1] = true;
+    TEST_ASSERT_EQUAL(2, barrerConfirmando());
+
+    presionadas[1][0] = true;
+    now += RETARDO;
+    TEST_ASSERT_EQUAL(0, barrerConfirmando());
+    TEST_ASSERT_FALSE(matrix_IsPressed(&matrix, TECLA(1, 1)));
+    TEST_ASSERT_TRUE(matrix_IsPressed(&matrix, TECLA(0, 0)));
+    TEST_ASSERT_GREATER_THAN(0, matrix_GhostCount(&matrix));
+
+    /* Al soltar una esquina desaparece la ambigüedad y la tecla real se confirma */
+    presionadas[0][1] = false;
+    now += RETARDO;
+    TEST_ASSERT_EQUAL(2, barrerConfirmando());
+    TEST_ASSERT_TRUE(matrix_IsPressed(&matrix, TECLA(1, 0)));
+    TEST_ASSERT_FALSE(matrix_IsPressed(&matrix, TECLA(0, 1)));
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,296 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file test_API_scheduler.c
+ * @brief Pruebas unitarias del planificador cooperativo, con un reloj simulado
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "API_scheduler.h"
+#include "API_delay.h"
+#include "hal_host.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Máxima cantidad de pasos registrados por prueba */
+#define MAX_PASOS 16
+
+/* === Private data type declarations ========================================================== */
+/**
+ * @struct carga_t
+ * @brief Comportamiento de una tarea de prueba
+ */
+typedef struct {
+    char nombre;      /**< Se registra en pasos[] en cada paso */
+    tick_t duracion;  /**< Ticks que avanza el reloj en cada paso */
+    bool suspender;   /**< Suspende la tarea al terminar el trabajo */
+} carga_t;
+
+/* === Private variable declarations =========================================================== */
+static tick_t reloj;
+static schedulerTask_t tareas[SCHEDULER_MAX_TAREAS + 1];
+static carga_t cargas[SCHEDULER_MAX_TAREAS + 1];
+/** @brief Nombres de las tareas en el orden en que avanzaron */
+static char pasos[MAX_PASOS + 1];
+static int cantidad;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+//! * @brief Fuente de reloj simulada de los retardos.
+tick_t leerReloj(void) {
+    return reloj;
+}
+
+//! * @brief Registra el paso y consume la duración de la carga.
+void registrarPaso(schedulerTask_t * tarea, carga_t * carga) {
+    (void)tarea;
+    if (cantidad < MAX_PASOS) {
+        pasos[cantidad] = carga->nombre;
+    }
+    cantidad++;
+    reloj += carga->duracion;
+}
+
+//! * @brief Tarea de un solo paso.
+schedulerResult_t simple(schedulerTask_t * tarea, void * contexto) {
+    carga_t * carga = contexto;
+
+    registrarPaso(tarea, carga);
+    if (carga->suspender) {
+        scheduler_Suspend(tarea);
+    }
+    return SCHEDULER_DONE;
+}
+
+//! * @brief Tarea de dos pasos que cede el procesador entre ellos.
+schedulerResult_t enDosPasos(schedulerTask_t * tarea, void * contexto) {
+    carga_t * carga = contexto;
+
+    SCHEDULER_BEGIN(tarea);
+    registrarPaso(tarea, carga);
+    SCHEDULER_YIELD(tarea);
+    registrarPaso(tarea, carga);
+    SCHEDULER_END(tarea);
+}
+
+//! * @brief Tarea de un solo paso que vence el servicio de temporizadores desde su cuerpo.
+schedulerResult_t conDelayProcess(schedulerTask_t * tarea, void * contexto) {
+    registrarPaso(tarea, contexto);
+    delayProcess();
+    return SCHEDULER_DONE;
+}
+
+//! * @brief Registra una tarea de prueba con su carga.
+bool agregar(int n, schedulerTaskFn_t funcion, char nombre, tick_t periodo, tick_t plazo,
+             uint8_t prioridad) {
+    cargas[n] = (carga_t){nombre, 0, false};
+    return scheduler_Add(&tareas[n], funcion, &cargas[n], periodo, plazo, prioridad);
+}
+
+void setUp(void) {
+    reloj = 1000;
+    delay_SetClock(leerReloj);
+    scheduler_Init();
+    memset(pasos, 0, sizeof(pasos));
+    cantidad = 0;
+}
+
+void tearDown(void) {
+    scheduler_Init();
+    delay_SetClock(NULL);
+}
+
+//! * @test 1. Una tarea periódica se activa en cada período sin acumular el atraso del lazo.
+void test_activaciones_periodicas_sin_atraso(void) {
+    schedulerStats_t stats;
+
+    TEST_ASSERT_TRUE(agregar(0, simple, 'a', 10, 0, 0));
+    scheduler_Run();
+    reloj = 1009;
+    scheduler_Run();
+    TEST_ASSERT_EQUAL(1, cantidad);
+
+    reloj = 1013;
+    scheduler_Run();
+    reloj = 1020;
+    scheduler_Run();
+    TEST_ASSERT_EQUAL(3, cantidad);
+
+    scheduler_GetStats(&tareas[0], &stats);
+    TEST_ASSERT_EQUAL(3, stats.ejecuciones);
+    TEST_ASSERT_EQUAL(0, stats.sobrecargas);
+    TEST_ASSERT_EQUAL(3, stats.latenciaMax);
+}
+
+//! * @test 2. Las tareas listas avanzan por prioridad y, a igual prioridad, por período.
+void test_orden_por_prioridad_y_periodo(void) {
+    TEST_ASSERT_TRUE(agregar(0, simple, 'a', 20, 0, 1));
+    TEST_ASSERT_TRUE(agregar(1, simple, 'b', 50, 0, 0));
+    TEST_ASSERT_TRUE(agregar(2, simple, 'c', 10, 0, 1));
+
+    scheduler_Run();
+    TEST_ASSERT_EQUAL_STRING("bca", pasos);
+}
+
+//! * @test 3. Un protohilo que cede deja avanzar al resto y se reanuda en la pasada siguiente.
+void test_protohilo_cede_y_se_reanuda(void) {
+    schedulerStats_t stats;
+
+    TEST_ASSERT_TRUE(agregar(0, enDosPasos, 'p', 100, 0, 0));
+    TEST_ASSERT_TRUE(agregar(1, simple, 'q', 100, 0, 1));
+    cargas[0].duracion = 2;
+    cargas[1].duracion = 1;
+
+    TEST_ASSERT_TRUE(scheduler_Run());
+    TEST_ASSERT_EQUAL_STRING("pq", pasos);
+    TEST_ASSERT_FALSE(scheduler_Run());
+    TEST_ASSERT_EQUAL_STRING("pqp", pasos);
+
+    scheduler_GetStats(&tareas[0], &stats);
+    TEST_ASSERT_EQUAL(1, stats.ejecuciones);
+    TEST_ASSERT_EQUAL(4, stats.ejecucionMax);
+    TEST_ASSERT_EQUAL(4, stats.ejecucionTotal);
+}
+
+//! * @test 4. Se cuentan los trabajos fuera de plazo y las activaciones perdidas por atraso.
+void test_sobrecargas(void) {
+    schedulerStats_t stats;
+
+    TEST_ASSERT_TRUE(agregar(0, simple, 'a', 10, 5, 0));
+    cargas[0].duracion = 7;
+    scheduler_Run();
+    scheduler_GetStats(&tareas[0], &stats);
+    TEST_ASSERT_EQUAL(1, stats.ejecuciones);
+    TEST_ASSERT_EQUAL(1, stats.sobrecargas);
+    TEST_ASSERT_EQUAL(7, stats.ejecucionMax);
+
+    /* Las activaciones de 1010 y 1020 se pierden, el trabajo corresponde a la de 1030 */
+    cargas[0].duracion = 0;
+    reloj = 1032;
+    scheduler_Run();
+    scheduler_GetStats(&tareas[0], &stats);
+    TEST_ASSERT_EQUAL(2, stats.ejecuciones);
+    TEST_ASSERT_EQUAL(3, stats.sobrecargas);
+    TEST_ASSERT_EQUAL(2, stats.latenciaMax);
+
+    reloj = 1039;
+    scheduler_Run();
+    reloj = 1040;
+    scheduler_Run();
+    TEST_ASSERT_EQUAL(3, cantidad);
+}
+
+//! * @test 5. Una tarea suspendida vuelve a activarse con scheduler_Activate(), aun en curso.
+void test_suspender_y_activar(void) {
+    TEST_ASSERT_TRUE(agregar(0, simple, 'a', 10, 0, 0));
+    TEST_ASSERT_TRUE(agregar(1, enDosPasos, 'e', 0, 0, 1));
+    cargas[0].suspender = true;
+    scheduler_Run();
+    reloj = 1030;
+    scheduler_Run();
+    TEST_ASSERT_EQUAL_STRING("a", pasos);
+
+    /* La esporádica recibe un segundo pedido mientras su trabajo sigue en curso */
+    cargas[0].suspender = false;
+    scheduler_Activate(&tareas[0]);
+    scheduler_Activate(&tareas[1]);
+    TEST_ASSERT_TRUE(scheduler_Run());
+    scheduler_Activate(&tareas[1]);
+    reloj = 1035;
+    TEST_ASSERT_TRUE(scheduler_Run());
+    TEST_ASSERT_EQUAL_STRING("aaee", pasos);
+    TEST_ASSERT_TRUE(scheduler_Run());
+    TEST_ASSERT_FALSE(scheduler_Run());
+    TEST_ASSERT_EQUAL_STRING("aaeeee", pasos);
+
+    /* Las activaciones periódicas siguen desde el pedido */
+    reloj = 1040;
+    scheduler_Run();
+    TEST_ASSERT_EQUAL_STRING("aaeeeea", pasos);
+    TEST_ASSERT_EQUAL(0, tareas[1].estadisticas.sobrecargas);
+}
+
+//! * @test 6. El reposo vuelve enseguida si ya venció una activación o hay un pedido pendiente.
+void test_reposo_sin_esperas(void) {
+    TEST_ASSERT_TRUE(agregar(0, simple, 'a', 10, 0, 0));
+    TEST_ASSERT_TRUE(agregar(1, simple, 'e', 0, 0, 1));
+    scheduler_Run();
+
+    reloj = 1010;
+    scheduler_Idle();
+    reloj = 1005;
+    scheduler_Activate(&tareas[1]);
+    scheduler_Idle();
+    scheduler_Run();
+    TEST_ASSERT_EQUAL_STRING("ae", pasos);
+}
+
+//! * @test 7. No se registran tareas repetidas, sin cuerpo, con período inválido ni de más.
+void test_registro_invalido(void) {
+    TEST_ASSERT_FALSE(agregar(0, NULL, 'a', 10, 0, 0));
+    TEST_ASSERT_FALSE(agregar(0, simple, 'a', DELAY_MAX + 1, 0, 0));
+    TEST_ASSERT_TRUE(agregar(0, simple, 'a', 10, 0, 0));
+    TEST_ASSERT_FALSE(scheduler_Add(&tareas[0], simple, &cargas[0], 10, 0, 0));
+
+    for (int n = 1; n < SCHEDULER_MAX_TAREAS; n++) {
+        TEST_ASSERT_TRUE(agregar(n, simple, 'b', 0, 0, 1));
+    }
+    TEST_ASSERT_FALSE(agregar(SCHEDULER_MAX_TAREAS, simple, 'c', 0, 0, 1));
+
+    scheduler_Remove(&tareas[0]);
+    TEST_ASSERT_TRUE(agregar(SCHEDULER_MAX_TAREAS, simple, 'c', 0, 0, 1));
+}
+
+//! * @test 8. Un cuerpo que llama a delayProcess() activa las tareas vencidas sin perder la cuenta.
+void test_delay_process_desde_una_tarea(void) {
+    schedulerStats_t stats;
+    tick_t proximo;
+
+    TEST_ASSERT_TRUE(agregar(0, conDelayProcess, 'a', 10, 0, 0));
+    TEST_ASSERT_TRUE(agregar(1, simple, 'b', 10, 0, 1));
+    cargas[0].duracion = 15;
+    TEST_ASSERT_FALSE(scheduler_Run());
+
+    /* Ambas activaciones de 1010 llegan con el trabajo anterior sin terminar */
+    scheduler_GetStats(&tareas[0], &stats);
+    TEST_ASSERT_EQUAL(2, stats.sobrecargas);
+    scheduler_GetStats(&tareas[1], &stats);
+    TEST_ASSERT_EQUAL(2, stats.sobrecargas);
+    TEST_ASSERT_EQUAL(15, stats.latenciaMax);
+    TEST_ASSERT_TRUE(delay_NextDeadline(&proximo));
+    TEST_ASSERT_EQUAL(1020, proximo);
+
+    cargas[0].duracion = 0;
+    reloj = 1020;
+    TEST_ASSERT_FALSE(scheduler_Run());
+    TEST_ASSERT_EQUAL_STRING("abab", pasos);
+}
+
+/* === End of documentation ==================================================================== */
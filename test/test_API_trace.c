@@ -0,0 +1,210 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file test_API_trace.c
+ * @brief Pruebas unitarias para la captura y reproducción de trazas de entradas
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "mock_API_IO.h"
+#include "API_trace.h"
+#include "API_debounce.h"
+#include "API_delay.h"
+#include "API_eventQueue.h"
+
+/* === Macros definitions ====================================================================== */
+#define CAPACIDAD 64
+#define MAX_EVENTOS 8
+#define BOTON (1u << IO_BUTTON_USER)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+static uint8_t buffer[CAPACIDAD];
+static trace_t traza;
+static traceReader_t lector;
+static event_t eventos[MAX_EVENTOS];
+static uint8_t cantidadEventos;
+static tick_t tickActual;
+static IO_ReadHook_t hookInstalado;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+//! * @brief El tick del sistema lo controla cada prueba.
+uint32_t HAL_GetTick(void) {
+    return tickActual;
+}
+
+//! * @brief Guarda el hook que el módulo instala en la capa IO.
+void IO_SetReadHook_Callback(IO_ReadHook_t hook, int cmock_num_calls) {
+    hookInstalado = hook;
+}
+
+//! * @brief Guarda los eventos entregados por la reproducción.
+void guardarEvento(const event_t * event, void * ctx) {
+    if (cantidadEventos < MAX_EVENTOS) {
+        eventos[cantidadEventos++] = *event;
+    }
+}
+
+void setUp(void) {
+    event_t descartado;
+
+    while (debounce_ReadEvent(&descartado)) {
+    }
+    cantidadEventos = 0;
+    tickActual = 0;
+    hookInstalado = NULL;
+}
+
+//! * @test 1. Los cambios grabados se leen con el mismo tick y la misma muestra.
+void test_traza_ida_y_vuelta(void) {
+    tick_t tick;
+    IO_Snapshot_t muestra;
+
+    TEST_ASSERT_TRUE(trace_InitWriter(&traza, buffer, CAPACIDAD, 1000, 0));
+    TEST_ASSERT_TRUE(trace_Record(&traza, 1003, BOTON));
+    TEST_ASSERT_TRUE(trace_Record(&traza, 200000, 0));
+    TEST_ASSERT_TRUE(trace_Finish(&traza, 250000));
+
+    TEST_ASSERT_TRUE(trace_InitReader(&lector, buffer, traza.largo));
+    TEST_ASSERT_EQUAL(1000, lector.inicio);
+    TEST_ASSERT_EQUAL(0, lector.inicial);
+    TEST_ASSERT_TRUE(trace_Next(&lector, &tick, &muestra));
+    TEST_ASSERT_EQUAL(1003, tick);
+    TEST_ASSERT_EQUAL(BOTON, muestra);
+    TEST_ASSERT_TRUE(trace_Next(&lector, &tick, &muestra));
+    TEST_ASSERT_EQUAL(200000, tick);
+    TEST_ASSERT_EQUAL(0, muestra);
+    TEST_ASSERT_FALSE(trace_Next(&lector, &tick, &muestra));
+    TEST_ASSERT_TRUE(lector.completa);
+    TEST_ASSERT_EQUAL(250000, lector.tick);
+}
+
+//! * @test 2. Las muestras sin cambios no ocupan espacio en la traza.
+void test_muestras_repetidas_no_ocupan_espacio(void) {
+    uint32_t largo;
+
+    trace_InitWriter(&traza, buffer, CAPACIDAD, 0, BOTON);
+    largo = traza.largo;
+    for (tick_t tick = 1; tick < 1000; tick++) {
+        TEST_ASSERT_TRUE(trace_Record(&traza, tick, BOTON));
+    }
+    TEST_ASSERT_EQUAL(largo, traza.largo);
+}
+
+//! * @test 3. Una traza llena descarta muestras pero sigue siendo válida hasta la última grabada.
+void test_traza_llena_sigue_valida(void) {
+    tick_t tick;
+    IO_Snapshot_t muestra;
+    uint16_t leidos = 0;
+    uint16_t grabados = 0;
+
+    trace_InitWriter(&traza, buffer, CAPACIDAD, 0, 0);
+    for (tick_t t = 1; t <= CAPACIDAD; t++) {
+        if (trace_Record(&traza, t, t)) {
+            grabados++;
+        }
+    }
+    TEST_ASSERT_TRUE(traza.descartadas > 0);
+    TEST_ASSERT_FALSE(trace_Finish(&traza, CAPACIDAD));
+
+    TEST_ASSERT_TRUE(trace_InitReader(&lector, buffer, traza.largo));
+    while (trace_Next(&lector, &tick, &muestra)) {
+        leidos++;
+    }
+    TEST_ASSERT_TRUE(lector.completa);
+    TEST_ASSERT_EQUAL(grabados, leidos);
+}
+
+//! * @test 4. Un buffer que no empieza con la cabecera de traza se rechaza.
+void test_cabecera_invalida(void) {
+    const uint8_t basura[] = {'D', 'B', 'T', 'X', TRACE_VERSION, 0, 0};
+    const uint8_t otraVersion[] = {'D', 'B', 'T', 'R', TRACE_VERSION + 1, 0, 0};
+
+    TEST_ASSERT_FALSE(trace_InitReader(&lector, basura, sizeof(basura)));
+    TEST_ASSERT_FALSE(trace_InitReader(&lector, otraVersion, sizeof(otraVersion)));
+}
+
+//! * @test 5. La reproducción de una traza con rebotes confirma solo las pulsaciones estables,
+//! *          con el tick virtual en el que vence el retardo.
+void test_reproduccion_de_rebotes(void) {
+    debounce_t boton;
+    uint32_t confirmados;
+
+    trace_InitWriter(&traza, buffer, CAPACIDAD, 1000, 0);
+    /* Presión con rebotes */
+    trace_Record(&traza, 1100, BOTON);
+    trace_Record(&traza, 1102, 0);
+    trace_Record(&traza, 1105, BOTON);
+    /* Liberación con rebotes */
+    trace_Record(&traza, 1500, 0);
+    trace_Record(&traza, 1501, BOTON);
+    trace_Record(&traza, 1503, 0);
+    /* Pulso más corto que el retardo */
+    trace_Record(&traza, 1800, BOTON);
+    trace_Record(&traza, 1810, 0);
+    trace_Finish(&traza, 2000);
+
+    debounce_Init(&boton, IO_BUTTON_USER);
+    trace_InitReader(&lector, buffer, traza.largo);
+    confirmados = trace_Replay(&lector, &boton, 1, 1, guardarEvento, NULL);
+
+    TEST_ASSERT_EQUAL(2, confirmados);
+    TEST_ASSERT_EQUAL(2, cantidadEventos);
+    TEST_ASSERT_EQUAL(EVENT_PRESSED, eventos[0].edge);
+    TEST_ASSERT_EQUAL(IO_BUTTON_USER, eventos[0].device);
+    TEST_ASSERT_EQUAL(1150, eventos[0].tick);
+    TEST_ASSERT_EQUAL(EVENT_RELEASED, eventos[1].edge);
+    TEST_ASSERT_EQUAL(1550, eventos[1].tick);
+}
+
+//! * @test 6. Con una traza activa cada lectura de la capa IO queda grabada con el tick del sistema.
+void test_grabacion_desde_la_capa_io(void) {
+    tick_t tick;
+    IO_Snapshot_t muestra;
+
+    IO_SetReadHook_StubWithCallback(IO_SetReadHook_Callback);
+    trace_InitWriter(&traza, buffer, CAPACIDAD, 0, 0);
+    trace_Attach(&traza);
+    TEST_ASSERT_NOT_NULL(hookInstalado);
+
+    tickActual = 42;
+    hookInstalado(BOTON);
+    trace_Attach(NULL);
+    TEST_ASSERT_NULL(hookInstalado);
+    trace_Finish(&traza, 50);
+
+    trace_InitReader(&lector, buffer, traza.largo);
+    TEST_ASSERT_TRUE(trace_Next(&lector, &tick, &muestra));
+    TEST_ASSERT_EQUAL(42, tick);
+    TEST_ASSERT_EQUAL(BOTON, muestra);
+}
@@ -0,0 +1,129 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file test_API_vcounter.c
+ * @brief Pruebas unitarias para el antirrebote por contadores verticales
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "API_vcounter.h"
+
+/* === Macros definitions ====================================================================== */
+#define ENTRADA_0 (1u << 0)
+#define ENTRADA_5 (1u << 5)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+static vcounter_t vcounter;
+static vcounter_word_t presionados;
+static vcounter_word_t liberados;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+//! * @brief Procesa la misma muestra la cantidad de veces indicada acumulando los flancos.
+void muestrear(vcounter_word_t muestra, int cantidad) {
+    vcounter_word_t pressed, released;
+
+    for (int i = 0; i < cantidad; i++) {
+        vcounter_Update(&vcounter, muestra, &pressed, &released);
+        presionados |= pressed;
+        liberados |= released;
+    }
+}
+
+void setUp(void) {
+    vcounter_Init(&vcounter, 0);
+    presionados = 0;
+    liberados = 0;
+}
+
+//! * @test 1. La presión se confirma recién con VCOUNTER_MUESTRAS muestras consecutivas.
+void test_presion_se_confirma_tras_muestras_consecutivas(void) {
+
+    muestrear(ENTRADA_0, VCOUNTER_MUESTRAS - 1);
+    TEST_ASSERT_EQUAL_HEX32(0, presionados);
+
+    muestrear(ENTRADA_0, 1);
+    TEST_ASSERT_EQUAL_HEX32(ENTRADA_0, presionados);
+    TEST_ASSERT_EQUAL_HEX32(0, liberados);
+}
+
+//! * @test 2. El flanco de presión se informa una única vez aunque el botón siga presionado.
+void test_presion_se_informa_una_vez(void) {
+    vcounter_word_t pressed, released;
+
+    muestrear(ENTRADA_0, VCOUNTER_MUESTRAS);
+    vcounter_Update(&vcounter, ENTRADA_0, &pressed, &released);
+
+    TEST_ASSERT_EQUAL_HEX32(0, pressed);
+    TEST_ASSERT_EQUAL(BUTTON_DOWN, vcounter_State(&vcounter, 0));
+}
+
+//! * @test 3. Un rebote durante el conteo vuelve la entrada a BUTTON_UP sin generar eventos.
+void test_rebote_aborta_la_presion(void) {
+
+    muestrear(ENTRADA_0, VCOUNTER_MUESTRAS - 1);
+    TEST_ASSERT_EQUAL(BUTTON_FALLING, vcounter_State(&vcounter, 0));
+
+    muestrear(0, 1);
+    TEST_ASSERT_EQUAL(BUTTON_UP, vcounter_State(&vcounter, 0));
+
+    muestrear(ENTRADA_0, VCOUNTER_MUESTRAS - 1);
+    TEST_ASSERT_EQUAL_HEX32(0, presionados);
+}
+
+//! * @test 4. La liberación recorre BUTTON_RISING y se informa en la máscara de liberados.
+void test_liberacion_pasa_por_rising(void) {
+
+    muestrear(ENTRADA_0, VCOUNTER_MUESTRAS);
+    muestrear(0, 1);
+    TEST_ASSERT_EQUAL(BUTTON_RISING, vcounter_State(&vcounter, 0));
+
+    muestrear(0, VCOUNTER_MUESTRAS - 1);
+    TEST_ASSERT_EQUAL(BUTTON_UP, vcounter_State(&vcounter, 0));
+    TEST_ASSERT_EQUAL_HEX32(ENTRADA_0, liberados);
+}
+
+//! * @test 5. Las entradas de una misma palabra evolucionan de forma independiente.
+void test_entradas_independientes(void) {
+
+    vcounter_Init(&vcounter, ENTRADA_5);
+
+    muestrear(ENTRADA_0, VCOUNTER_MUESTRAS);
+
+    TEST_ASSERT_EQUAL_HEX32(ENTRADA_0, presionados);
+    TEST_ASSERT_EQUAL_HEX32(ENTRADA_5, liberados);
+    TEST_ASSERT_EQUAL(BUTTON_DOWN, vcounter_State(&vcounter, 0));
+    TEST_ASSERT_EQUAL(BUTTON_UP, vcounter_State(&vcounter, 5));
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,84 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file test_hal_host.c
+ * @brief Pruebas unitarias de las bases de tiempo de la HAL emulada en Linux
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "API_delay.h"
+#include "hal_host.h"
+#include <time.h>
+
+/* === Macros definitions ====================================================================== */
+/** @brief Mayor salto aceptado entre dos lecturas seguidas, en microsegundos */
+#define SALTO_MAXIMO_US 100000
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+    TEST_ASSERT_EQUAL(HAL_OK, HAL_Init());
+}
+
+void tearDown(void) {
+    HAL_SuspendTick();
+    delay_SetClock(NULL);
+}
+
+//! * @test 1. Los ticks de microsegundos de HAL_Host_GetMicros() como fuente de API_delay nunca
+//! *         retroceden, tampoco al pasar de segundo.
+void test_micros_no_retroceden_al_pasar_de_segundo(void) {
+    struct timespec primero;
+    struct timespec ahora;
+    tick_t anterior;
+    int segundos = 0;
+
+    delay_SetClock(HAL_Host_GetMicros);
+    anterior = delayGetTick();
+    clock_gettime(CLOCK_MONOTONIC, &primero);
+
+    /* Se recorre al menos un cambio de segundo completo, con tv_nsec por debajo del inicial */
+    do {
+        tick_t tick = delayGetTick();
+
+        TEST_ASSERT_TRUE((int32_t)(tick - anterior) >= 0);
+        TEST_ASSERT_TRUE(tick - anterior < SALTO_MAXIMO_US);
+        anterior = tick;
+        clock_gettime(CLOCK_MONOTONIC, &ahora);
+        segundos = (int)(ahora.tv_sec - primero.tv_sec);
+    } while (segundos < 1 || ahora.tv_nsec < 500000000);
+}
+
+/* === End of documentation ==================================================================== */
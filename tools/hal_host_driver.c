@@ -0,0 +1,135 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file hal_host_driver.c
+ * @brief Proceso que simula el hardware del firmware compilado con HAL_HOST
+ * @details Mapea la misma página de registros que el firmware (HAL_HOST_SHM) y permite cambiar
+ * entradas, generar rebotes y leer salidas sin copias. Cada cambio de IDR se notifica al firmware
+ * con SIGUSR1, que la HAL emulada convierte en HAL_GPIO_EXTI_Callback().
+ *
+ * Uso:
+ * - hal_host_driver <shm> set <puerto> <pin> <0|1>
+ * - hal_host_driver <shm> bounce <puerto> <pin> <0|1> <rebotes> <us entre rebotes>
+ * - hal_host_driver <shm> get <puerto> <pin>
+ *
+ * Donde puerto es una letra de A a H, por ejemplo: hal_host_driver /tsse set B 3 1
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hal_host.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/** @brief La HAL define los puertos sobre este símbolo; aquí apunta a la página compartida */
+hal_host_regs_t hal_host_regs;
+
+/* === Private variable definitions ============================================================ */
+
+/** @brief Página compartida con el firmware */
+static hal_host_regs_t * registros;
+
+/* === Private function implementation ========================================================= */
+
+static int uso(void) {
+    fprintf(stderr, "uso: hal_host_driver <shm> set <puerto> <pin> <0|1>\n"
+                    "     hal_host_driver <shm> bounce <puerto> <pin> <0|1> <rebotes> <us>\n"
+                    "     hal_host_driver <shm> get <puerto> <pin>\n");
+    return 2;
+}
+
+static void escribirEntrada(GPIO_TypeDef * puerto, uint32_t pin, int nivel) {
+    if (nivel) {
+        __atomic_fetch_or(&puerto->IDR, pin, __ATOMIC_RELEASE);
+    } else {
+        __atomic_fetch_and(&puerto->IDR, ~pin, __ATOMIC_RELEASE);
+    }
+    if (registros->magic == HAL_HOST_MAGIC && registros->pid > 0) {
+        kill(registros->pid, SIGUSR1);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char * argv[]) {
+    if (argc < 5) {
+        return uso();
+    }
+
+    int fd = shm_open(argv[1], O_RDWR | O_CREAT, 0600);
+    if (fd < 0 || ftruncate(fd, HAL_HOST_PAGE) != 0) {
+        perror("shm_open");
+        return 1;
+    }
+    registros = mmap(NULL, HAL_HOST_PAGE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (registros == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+
+    int indice = argv[3][0] - 'A';
+    int numero = atoi(argv[4]);
+    if (indice < 0 || indice >= HAL_HOST_PORTS || numero < 0 || numero > 15) {
+        return uso();
+    }
+    GPIO_TypeDef * puerto = &registros->gpio[indice];
+    uint32_t pin = 1u << numero;
+
+    if (strcmp(argv[2], "get") == 0) {
+        printf("%d\n", (puerto->ODR & pin) != 0);
+    } else if (strcmp(argv[2], "set") == 0 && argc == 6) {
+        escribirEntrada(puerto, pin, atoi(argv[5]));
+    } else if (strcmp(argv[2], "bounce") == 0 && argc == 8) {
+        int nivel = atoi(argv[5]);
+        int rebotes = atoi(argv[6]);
+        struct timespec pausa = {.tv_sec = 0, .tv_nsec = atol(argv[7]) * 1000L};
+
+        /* Alterna el pin y termina en el nivel pedido */
+        for (int i = 0; i < 2 * rebotes; i++) {
+            escribirEntrada(puerto, pin, (i % 2 == 0) ? nivel : !nivel);
+            nanosleep(&pausa, NULL);
+        }
+        escribirEntrada(puerto, pin, nivel);
+    } else {
+        return uso();
+    }
+    return 0;
+}
+
+/* === End of documentation ==================================================================== */
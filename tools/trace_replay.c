@@ -0,0 +1,197 @@
+/************************************************************************************************
+Copyright (c) 2025, Veronica Ruiz Galvan <veronica.ruizgalvan@hotmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file trace_replay.c
+ * @brief Reproduce trazas de entradas a través del antirrebote para comparar eventos en CI
+ * @details Lee una traza grabada con API_trace, la pasa por una instancia de antirrebote por
+ * dispositivo en tiempo virtual e imprime un evento por línea: "tick dispositivo flanco". La
+ * salida es determinista y se puede comparar con un archivo de referencia con diff. Al final
+ * informa por stderr el tiempo virtual reproducido y el tiempo real que tomó.
+ *
+ * Uso:
+ * - trace_replay play <traza> [período en ticks]
+ * - trace_replay synth <traza> <horas> [semilla]
+ *
+ * synth genera una traza de pulsaciones del botón de usuario con rebotes aleatorios, útil para
+ * armar archivos de referencia largos.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "API_trace.h"
+
+/* === Macros definitions ====================================================================== */
+/** @brief Bytes reservados por hora de traza sintética */
+#define SYNTH_BYTES_POR_HORA (512u * 1024u)
+
+/** @brief Ticks en una hora */
+#define TICKS_POR_HORA DELAY_MS(3600u * 1000u)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** @brief Nombres de los flancos en la salida */
+static const char * const nombresFlanco[] = {"NONE", "PRESSED", "RELEASED"};
+
+/* === Private function implementation ========================================================= */
+
+static int uso(void) {
+    fprintf(stderr, "uso: trace_replay play <traza> [periodo]\n"
+                    "     trace_replay synth <traza> <horas> [semilla]\n");
+    return 2;
+}
+
+static void imprimirEvento(const event_t * event, void * ctx) {
+    FILE * salida = ctx;
+
+    fprintf(salida, "%u %u %s\n", (unsigned)event->tick, (unsigned)event->device,
+            nombresFlanco[event->edge]);
+}
+
+static uint8_t * leerArchivo(const char * nombre, uint32_t * largo) {
+    FILE * archivo = fopen(nombre, "rb");
+    uint8_t * datos;
+    long tamanio;
+
+    if (archivo == NULL) {
+        perror(nombre);
+        return NULL;
+    }
+    fseek(archivo, 0, SEEK_END);
+    tamanio = ftell(archivo);
+    rewind(archivo);
+    datos = malloc(tamanio > 0 ? (size_t)tamanio : 1);
+    if (datos == NULL || fread(datos, 1, (size_t)tamanio, archivo) != (size_t)tamanio) {
+        perror(nombre);
+        free(datos);
+        datos = NULL;
+    }
+    fclose(archivo);
+    *largo = (uint32_t)tamanio;
+    return datos;
+}
+
+static double segundos(void) {
+    struct timespec ahora;
+
+    clock_gettime(CLOCK_MONOTONIC, &ahora);
+    return (double)ahora.tv_sec + (double)ahora.tv_nsec * 1e-9;
+}
+
+static int reproducir(const char * nombre, tick_t periodo) {
+    debounce_t instancias[IO_DEVICE_COUNT];
+    traceReader_t lector;
+    uint32_t largo;
+    uint32_t eventos;
+    uint8_t * datos = leerArchivo(nombre, &largo);
+    double inicio;
+
+    if (datos == NULL) {
+        return 1;
+    }
+    if (!trace_InitReader(&lector, datos, largo)) {
+        fprintf(stderr, "%s: no es una traza valida\n", nombre);
+        free(datos);
+        return 1;
+    }
+    for (uint16_t i = 0; i < IO_DEVICE_COUNT; i++) {
+        debounce_Init(&instancias[i], (IO_Device_t)i);
+    }
+
+    inicio = segundos();
+    eventos = trace_Replay(&lector, instancias, IO_DEVICE_COUNT, periodo, imprimirEvento, stdout);
+    fprintf(stderr, "%u eventos, %.1f h virtuales en %.3f s%s\n", (unsigned)eventos,
+            (double)(lector.tick - lector.inicio) / TICKS_POR_HORA, segundos() - inicio,
+            lector.completa ? "" : " (traza truncada)");
+    free(datos);
+    return lector.completa ? 0 : 1;
+}
+
+static int sintetizar(const char * nombre, uint32_t horas, unsigned semilla) {
+    const IO_Snapshot_t boton = 1u << IO_BUTTON_USER;
+    uint32_t capacidad = horas * SYNTH_BYTES_POR_HORA + TRACE_HEADER_MAX;
+    uint8_t * datos = malloc(capacidad);
+    tick_t fin = horas * TICKS_POR_HORA;
+    tick_t tick = 0;
+    IO_Snapshot_t nivel = 0;
+    trace_t traza;
+    FILE * archivo;
+
+    if (datos == NULL) {
+        perror("malloc");
+        return 1;
+    }
+    srand(semilla);
+    trace_InitWriter(&traza, datos, capacidad, 0, 0);
+    while (tick < fin) {
+        /* Espera en reposo, luego un flanco con 0 a 7 rebotes de 1 a 4 ms cada uno */
+        tick += DELAY_MS(100 + rand() % 3000);
+        nivel ^= boton;
+        for (int rebotes = rand() % 8; rebotes > 0; rebotes--) {
+            trace_Record(&traza, tick, nivel);
+            tick += DELAY_MS(1 + rand() % 4);
+            trace_Record(&traza, tick, nivel ^ boton);
+            tick += DELAY_MS(1 + rand() % 4);
+        }
+        trace_Record(&traza, tick, nivel);
+    }
+    if (!trace_Finish(&traza, tick)) {
+        fprintf(stderr, "%s: buffer insuficiente\n", nombre);
+    }
+
+    archivo = fopen(nombre, "wb");
+    if (archivo == NULL || fwrite(datos, 1, traza.largo, archivo) != traza.largo) {
+        perror(nombre);
+        free(datos);
+        return 1;
+    }
+    fclose(archivo);
+    fprintf(stderr, "%u bytes\n", (unsigned)traza.largo);
+    free(datos);
+    return 0;
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char * argv[]) {
+    if (argc >= 3 && strcmp(argv[1], "play") == 0) {
+        return reproducir(argv[2], argc > 3 ? (tick_t)atol(argv[3]) : 1);
+    }
+    if (argc >= 4 && strcmp(argv[1], "synth") == 0) {
+        return sintetizar(argv[2], (uint32_t)atol(argv[3]),
+                          argc > 4 ? (unsigned)atol(argv[4]) : 1u);
+    }
+    return uso();
+}
+
+/* === End of documentation ==================================================================== */